@@ -77,8 +77,6 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 	/* Get the next expiry point */
 	P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) next_ep;
 		
-	P2CONST(tpl_action, AUTOMATIC, OS_APPL_DATA)  action_desc;
-  VAR(tpl_action_count, AUTOMATIC)  i;
 	
 	VAR(tpl_tick, AUTOMATIC) before;
 	
@@ -113,11 +111,7 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 		if (next_ep->offset == 0)
 		{
       /*launch all the actions of the expiry point*/
-			for (i = 0; i < next_ep->count; i++)
-			{
-				action_desc = (next_ep->actions)[i];
-				(action_desc->action)(action_desc);
-			}			
+			(next_ep->expire)();
 
       /* Increment index because the first one has just been launched */
       next->index = 1;
@@ -144,11 +138,7 @@ FUNC(void, OS_CODE) tpl_action_finalize_schedule_table(
 		if(schedtable->expiry[0]->sync_offset == 0)
 		{		
       /*launch all the actions of the expiry point*/
-			for (i = 0; i < schedtable->expiry[0]->count; i++)
-			{
-				action_desc = (schedtable->expiry[0]->actions)[i];
-				(action_desc->action)(action_desc);
-			}
+			(schedtable->expiry[0]->expire)();
 						
 			/* reset the offset of the first expiry point too */
 			(schedtable->expiry)[0]->sync_offset = (schedtable->expiry)[0]->offset;
@@ -377,7 +377,7 @@ FUNC(tpl_status, OS_CODE) tpl_terminate_application_service(
             tpl_dyn_proc_table[proc_id]->state = SUSPENDED;
             tpl_dyn_proc_table[proc_id]->activate_count = 0;
             tpl_dyn_proc_table[proc_id]->priority =
-            tpl_stat_proc_table[proc_id]->base_priority;
+            TPL_PROC_BASE_PRIORITY(proc_id);
           }
         }
 #endif
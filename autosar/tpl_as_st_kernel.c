@@ -197,17 +197,11 @@ FUNC(void, OS_CODE) tpl_process_schedtable(
   P2VAR(tpl_expiry_point, AUTOMATIC, OS_APPL_DATA) current_ep =
   	(schedtable->expiry)[index];
 
-  P2CONST(tpl_action, AUTOMATIC, OS_APPL_DATA)  action_desc;
-  VAR(tpl_action_count, AUTOMATIC)  i;
 	
 	VAR(tpl_expiry_count, AUTOMATIC) abs_deviation = ( ~(((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->deviation - 1 ) );
 	
   /*launch all the actions of the expiry point*/
-  for (i = 0; i < current_ep->count; i++)
-  {
-    action_desc = (current_ep->actions)[i];
-    (action_desc->action)(action_desc);
-  }
+  (current_ep->expire)();
 	
   index = ((P2VAR(tpl_schedule_table, AUTOMATIC, OS_APPL_DATA))st)->index;
 	
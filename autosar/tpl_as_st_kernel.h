@@ -84,6 +84,14 @@ struct TPL_SCHEDTABLE_SYNC {
                                                      (hard or smooth)         */
 };
 
+/**
+ * @typedef tpl_expiry_point_func
+ *
+ * Prototype of the function generated by goil for an expiry point. It
+ * does all the actions of the expiry point.
+ */
+typedef P2FUNC(void, OS_CODE, tpl_expiry_point_func)(void);
+
 /**
  * @struct TPL_EXPIRY_POINT
  *
@@ -103,6 +111,8 @@ struct TPL_EXPIRY_POINT {
                                                                the expiry point                   */
     P2CONST(tpl_action, TYPEDEF, OS_APPL_DATA) *actions;    /**< pointer to an array of actions to
                                                                be done at that offset.            */
+    VAR(tpl_expiry_point_func, TYPEDEF)        expire;     /**< goil generated function doing the
+                                                               actions with direct calls          */
     VAR(tpl_tick, TYPEDEF)                     max_advance;/**< maximum advance deviation from
                                                                initial offset of expiry point
                                                                after synchronization              */
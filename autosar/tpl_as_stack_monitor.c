@@ -23,23 +23,23 @@
  */
 #include "tpl_as_stack_monitor.h"
 #include "tpl_os_kernel.h"
+#include "tpl_os_os_kernel.h"
+
+#if WITH_STACK_MONITORING == YES
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
-#if WITH_AUTOSAR_STACK_MONITORING == YES
 FUNC(void, OS_CODE) tpl_check_stack (
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
-  CONSTP2CONST(tpl_stack, AUTOMATIC, OS_APPL_DATA) stack =
-    &(tpl_stat_proc_table[proc_id]->stack);
   /* MISRA RULE 33 VIOLATION: MISRA rule 33 says the right hand of
      a && or || operator shall not contain side effects (function call
      for instance). However this is intended here because
      tpl_check_stack_footprint does not need to be evaluated if
      tpl_check_stack_pointer fails                                        */
-  if ((!tpl_check_stack_pointer(stack)) ||
-      (!tpl_check_stack_footprint(stack)))
+  if ((!tpl_check_stack_pointer(proc_id)) ||
+      (!tpl_check_stack_footprint(proc_id)))
   {
 /*
  * see 7.4.2 of AUTOSAR SWS OS 2.1, related to requirements
@@ -56,4 +56,4 @@ FUNC(void, OS_CODE) tpl_check_stack (
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
-#endif /* WITH_AUTOSAR_STACK_MONITORING */
+#endif /* WITH_STACK_MONITORING */
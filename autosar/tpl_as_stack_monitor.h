@@ -25,7 +25,7 @@
  * $URL$
  */
 #ifndef TPL_AS_STACK_MONITOR_H
-#define TPL_AS_STACK_MONITOR_H_
+#define TPL_AS_STACK_MONITOR_H
 
 #include "tpl_machine_interface.h"
 #include "tpl_as_protec_hook.h"
@@ -175,7 +175,11 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_terminate_or_wait(
         /* If the watchdog is active, cancel it */ 
         if(tp->watchdogs[EXECUTIONBUDGET].is_active == TRUE)
         {
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+            tpl_cancel_tpwatchdog_kind(EXECUTIONBUDGET);
+#else
             tpl_cancel_tpwatchdog();
+#endif
         }
         /* and we reset the EXECUTIONBUDGET watchdog data for the next instance */
         tp->watchdogs[EXECUTIONBUDGET].remaining = s_proc->executionbudget;        
@@ -184,7 +188,10 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_terminate_or_wait(
 }
 
 /** 
- * The task is started: its active watchdogs shall be started too
+ * The task is started: its active watchdogs shall be started too.
+ * When the machine has one watchdog per kind, each active watchdog is
+ * armed with its own remaining budget. Otherwise the one with the
+ * shortest remaining budget is armed.
  */
 FUNC(tpl_bool, OS_CODE) tpl_tp_on_start(
         CONST(tpl_proc_id, AUTOMATIC) proc_id)
@@ -208,6 +215,9 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_start(
             if (tp->watchdogs[c].is_active == TRUE)
             {
                 tp->watchdogs[c].start_date = now;
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+                tpl_set_tpwatchdog_kind(c, tp->watchdogs[c].remaining);
+#endif
                 if(tp->watchdogs[c].remaining < tp->watchdogs[min_id].remaining)
                 {
                     min_id = c;
@@ -218,7 +228,9 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_start(
         /* Set an expiry point when the shortest remaining budget will reach 0 */
         tpl_tp_set_watchdog_id(min_id, proc_id);
 
+#ifndef TPL_TP_WATCHDOG_PER_KIND
         tpl_set_tpwatchdog(tp->watchdogs[min_id].remaining);
+#endif
     }
     return TRUE;
 }
@@ -238,14 +250,19 @@ FUNC(tpl_bool, OS_CODE) tpl_tp_on_preempt(
     {
         now = tpl_get_tptimer();
 
+#ifndef TPL_TP_WATCHDOG_PER_KIND
         /* First, we cancel the expiry point */
         tpl_cancel_tpwatchdog();
+#endif
 
         /* Then we update the remaining budgets of active watchdogs */
         for(c = 0; c < NB_WATCHDOGS_PER_PROC; c++)
         {
             if(tp->watchdogs[c].is_active == TRUE)
             {
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+                tpl_cancel_tpwatchdog_kind(c);
+#endif
                 tp->watchdogs[c].remaining -= now - tp->watchdogs[c].start_date;
             }
         }
@@ -304,6 +321,33 @@ FUNC(tpl_bool, OS_CODE) tpl_watchdog_expiration(void)
     return TRUE;
 }
 
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+/**
+ * The watchdog kind of the current core has expired. The other
+ * watchdogs of the proc are stopped and the expiration is processed as
+ * if kind was the watchdog armed.
+ */
+FUNC(tpl_bool, OS_CODE) tpl_watchdog_kind_expiration(
+    CONST(uint8, AUTOMATIC) kind)
+{
+    GET_CURRENT_CORE_ID(core_id)
+    CONSTP2VAR(tpl_timing_protection, AUTOMATIC, OS_APPL_DATA)  
+        tp = tpl_stat_proc_table[GET_TP_WATCHDOG_OWNER(core_id)]->timing_protection;
+    VAR(unsigned int, AUTOMATIC) c;
+
+    for(c = 0; c < NB_WATCHDOGS_PER_PROC; c++)
+    {
+        if((c != kind) && (tp->watchdogs[c].is_active == TRUE))
+        {
+            tpl_cancel_tpwatchdog_kind(c);
+        }
+    }
+    GET_TP_WATCHDOG_ID(core_id) = kind;
+
+    return tpl_watchdog_expiration();
+}
+#endif /* TPL_TP_WATCHDOG_PER_KIND */
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -130,6 +130,18 @@ typedef struct TPL_TIMING_PROTECTION tpl_timing_protection;
  */
 extern FUNC(tpl_bool, OS_CODE) tpl_watchdog_expiration(void);
 
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+/**
+ * @internal
+ *
+ * This function is called when the watchdog kind (EXECUTIONBUDGET,
+ * RESOURCELOCK, ALLINTERRUPTLOCK or OSINTERRUPTLOCK) of the current
+ * core is expired, on machines that have one watchdog per kind.
+ */
+extern FUNC(tpl_bool, OS_CODE) tpl_watchdog_kind_expiration(
+  CONST(uint8, AUTOMATIC) kind);
+#endif
+
 /**
  * Function used to initialize the activity flags of the watchdog
  * of the timing protection service. Must be called when an instance is 
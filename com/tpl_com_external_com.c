@@ -9,130 +9,474 @@
  * Trampoline external communication functions. These functions are
  * attached to the message object.
  *
+ * A message sent to the network is packed in the buffer of its I-PDU.
+ * A TRIGGERED message triggers the transmission of the I-PDU, a PENDING
+ * one only updates the buffer. A DIRECT I-PDU is sent when it is
+ * triggered, a PERIODIC one at each period and a MIXED one both.
+ *
+ * The periods, the minimum delay times and the bus cycle are counted in
+ * ticks of the COM counter (COM::COUNTER). When the bus cycle is not 0,
+ * the triggered I-PDUs wait for the end of the bus cycle and the I-PDUs
+ * of a bus are given to its driver in one batch. The periodic I-PDUs of
+ * a tick are always sent in one batch.
+ *
  * $Date$
  * $Rev$
  * $Author$
  * $URL$
  */
 
-
 #include "tpl_com_external_com.h"
 #include "tpl_com_internal_com.h"
+#include "tpl_com_notification.h"
 #include "tpl_os_definitions.h"
 #include "tpl_com_definitions.h"
 
+#if WITH_EXTERNAL_COM == YES
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if (SENDING_IPDU_COUNT > 0) && (WITH_COM_CYCLE == YES)
+/*
+ * Frames of the batch given to a bus driver
+ */
+STATIC VAR(tpl_com_frame, OS_VAR) tpl_com_batch[SENDING_IPDU_COUNT];
+#endif
+
+#if (WITH_COM_CYCLE == YES) && (TPL_COM_BUS_CYCLE > 1)
+/*
+ * Ticks of the COM counter before the end of the bus cycle
+ */
+STATIC VAR(uint32, OS_VAR) tpl_com_bus_cycle_left = TPL_COM_BUS_CYCLE;
+#endif
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
 /*
- * tpl_send_static_external_message sends a message from a static external 
+ * tpl_com_cpu_byte gives the index in a CPU ordered integer of size bytes
+ * of its byte of rank rank, rank 0 being the least significant byte.
+ */
+STATIC FUNC(uint8, OS_CODE) tpl_com_cpu_byte(
+  CONST(uint8, AUTOMATIC) rank,
+  CONST(uint8, AUTOMATIC) size)
+{
+  CONST(uint16, AUTOMATIC) one = 1;
+  VAR(uint8, AUTOMATIC) index = (uint8)(size - 1 - rank);
+
+  if (*(P2CONST(uint8, AUTOMATIC, OS_VAR))&one == 1)
+  {
+    /* little endian CPU */
+    index = rank;
+  }
+  return index;
+}
+
+/*
+ * tpl_com_net_byte gives the index in the I-PDU of the byte of rank rank
+ * of an unsigned integer network message, rank 0 being the least
+ * significant byte.
+ */
+STATIC FUNC(uint8, OS_CODE) tpl_com_net_byte(
+  CONSTP2CONST(tpl_net_location, AUTOMATIC, OS_CONST) location,
+  CONST(uint8, AUTOMATIC)                             rank)
+{
+  VAR(uint8, AUTOMATIC) index = (uint8)(location->offset + rank);
+
+  if (location->format == TPL_NET_BIG_ENDIAN)
+  {
+    index = (uint8)(location->offset + location->size - 1 - rank);
+  }
+  return index;
+}
+
+/*
+ * tpl_com_pack copies the data of a message to its network message in
+ * the buffer of an I-PDU. An unsigned integer is converted to the
+ * byte order of the network message and truncated or extended to its
+ * size. A byte array is copied and truncated or extended with zeros.
+ */
+STATIC FUNC(void, OS_CODE) tpl_com_pack(
+  CONSTP2VAR(uint8, AUTOMATIC, OS_VAR)                ipdu_buffer,
+  CONSTP2CONST(tpl_net_location, AUTOMATIC, OS_CONST) location,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR)       data,
+  CONST(uint8, AUTOMATIC)                             size)
+{
+  VAR(uint8, AUTOMATIC) i;
+
+  for (i = 0; i < location->size; i++)
+  {
+    if (location->format == TPL_NET_BYTEARRAY)
+    {
+      ipdu_buffer[location->offset + i] = (i < size) ? data[i] : 0;
+    }
+    else
+    {
+      ipdu_buffer[tpl_com_net_byte(location, i)] =
+        (i < size) ? data[tpl_com_cpu_byte(i, size)] : 0;
+    }
+  }
+}
+
+#if RECEIVING_IPDU_COUNT > 0
+/*
+ * tpl_com_unpack is the reverse of tpl_com_pack, it copies a network
+ * message of the buffer of an I-PDU to the data of a message of size
+ * bytes.
+ */
+STATIC FUNC(void, OS_CODE) tpl_com_unpack(
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR)         data,
+  CONST(uint8, AUTOMATIC)                             size,
+  CONSTP2CONST(uint8, AUTOMATIC, OS_VAR)              ipdu_buffer,
+  CONSTP2CONST(tpl_net_location, AUTOMATIC, OS_CONST) location)
+{
+  VAR(uint8, AUTOMATIC) i;
+
+  for (i = 0; i < size; i++)
+  {
+    if (location->format == TPL_NET_BYTEARRAY)
+    {
+      data[i] = (i < location->size) ? ipdu_buffer[location->offset + i] : 0;
+    }
+    else
+    {
+      data[tpl_com_cpu_byte(i, size)] = (i < location->size) ?
+        ipdu_buffer[tpl_com_net_byte(location, i)] : 0;
+    }
+  }
+}
+#endif
+
+/*
+ * tpl_com_frame_of_ipdu fills a frame with an I-PDU and starts the
+ * minimum delay time of the I-PDU. It returns FALSE when the IPDUCALLOUT
+ * cancels the transmission.
+ */
+STATIC FUNC(tpl_bool, OS_CODE) tpl_com_frame_of_ipdu(
+  CONSTP2VAR(tpl_com_frame, AUTOMATIC, OS_VAR)        frame,
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu)
+{
+  VAR(tpl_bool, AUTOMATIC) send = TRUE;
+
+  ipdu->dyn->pending = FALSE;
+  if (ipdu->callout != NULL)
+  {
+    send = (ipdu->callout() == COM_TRUE);
+  }
+  if (send)
+  {
+    frame->id = ipdu->id;
+    frame->size = ipdu->size;
+    frame->data = ipdu->buffer;
+    ipdu->dyn->delay_left = ipdu->min_delay;
+  }
+  return send;
+}
+
+#if (SENDING_IPDU_COUNT > 0) && (WITH_COM_CYCLE == YES)
+/*
+ * tpl_com_transmit sends the pending I-PDUs whose minimum delay time is
+ * elapsed, in one batch per bus.
+ */
+STATIC FUNC(void, OS_CODE) tpl_com_transmit(void)
+{
+  VAR(uint32, AUTOMATIC) bus_id;
+  VAR(uint32, AUTOMATIC) ipdu_id;
+  VAR(uint32, AUTOMATIC) count;
+
+  for (bus_id = 0; bus_id < COM_BUS_COUNT; bus_id++)
+  {
+    CONSTP2CONST(tpl_com_bus, AUTOMATIC, OS_CONST) bus =
+      tpl_com_bus_table[bus_id];
+
+    count = 0;
+    for (ipdu_id = 0; ipdu_id < SENDING_IPDU_COUNT; ipdu_id++)
+    {
+      CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+        tpl_sending_ipdu_table[ipdu_id];
+
+      if ((ipdu->bus == bus) &&
+          ipdu->dyn->pending &&
+          (ipdu->dyn->delay_left == 0))
+      {
+        if (tpl_com_frame_of_ipdu(&tpl_com_batch[count], ipdu))
+        {
+          count++;
+        }
+      }
+    }
+    if (count > 0)
+    {
+      bus->send(bus, tpl_com_batch, count);
+    }
+  }
+}
+#endif
+
+FUNC(void, OS_CODE) tpl_notify_ipdu(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu)
+{
+  /*
+   * A periodic I-PDU is only sent at each period. A direct or mixed
+   * one is sent now if the minimum delay time is elapsed and the bus
+   * does not batch the I-PDUs. Otherwise it waits in the pending state.
+   */
+  if ((ipdu->mode & IPDU_DIRECT) != 0)
+  {
+#if TPL_COM_BUS_CYCLE == 0
+    if (ipdu->dyn->delay_left == 0)
+    {
+      VAR(tpl_com_frame, AUTOMATIC) frame;
+
+      if (tpl_com_frame_of_ipdu(&frame, ipdu))
+      {
+        ipdu->bus->send(ipdu->bus, &frame, 1);
+      }
+    }
+    else
+#endif
+    {
+      ipdu->dyn->pending = TRUE;
+    }
+  }
+}
+
+/*
+ * tpl_send_static_external_message sends a message from a static external
  * sending message object to an IPDU.
  * This function is attached to the sending message object.
  */
 FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
-  CONSTP2CONST(void, COM_CONST, AUTOMATIC)   smo,
-  P2VAR(tpl_com_data, COM_VAR, AUTOMATIC)    data)
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
 {
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   /* cast the base mo to the correct type of mo */
-  CONSTP2CONST(tpl_external_sending_mo, COM_CONST, AUTOMATIC) esmo = smo;
-  /* get the pointer to the data buffer */
-  CONSTP2VAR(tpl_com_data, COM_VAR, AUTOMATIC) mo_buf = esmo->buffer.buffer;
+  CONSTP2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST) esmo = smo;
+  /* get the pointer to the last value sent */
+  CONSTP2VAR(tpl_com_data, AUTOMATIC, OS_VAR) mo_buf = esmo->buffer.buffer;
 
   /* filter the message */
   if (tpl_filtering(mo_buf, data, esmo->filter))
   {
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->base_mo.cpu_callout())
-#endif
-    {
-      /*
-       * does the byte ordering of the message or not.
-       * If cpu order and network order differs, the data are ordered and
-       * copied from buffer.buffer to buffer.ordered_buffer. If cpu order
-       * and network order are the same, the data are simply copied from
-       * buffer.buffer to buffer.ordered_buffer.
-       */
-      esmo->order(&(esmo->buffer));
-
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->base_mo.net_callout())
-#endif
-      {
-
-        /* copy & pack the message object in the IPDU */
-        esmo->copy_and_pack(esmo);
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->base_mo.property);
+    VAR(int, AUTOMATIC) i;
 
-      }
+    for (i = 0; i < esmo->buffer.size; i++)
+    {
+      mo_buf[i] = data[i];
+    }
+    /* pack the message in the IPDU */
+    tpl_com_pack(esmo->ipdu->buffer, &(esmo->location),
+                 data, (uint8)esmo->buffer.size);
+    /*
+     * notify the IPDU. According to the transmission mode, this
+     * may trigger the sending of the IPDU to the network.
+     */
+    if (esmo->triggered)
+    {
+      tpl_notify_ipdu(esmo->ipdu);
     }
   }
   /*
    * if at least an internal target exists,
    * the tpl_send_static_internal_message function is called
    */
-  if (NULL != esmo->base_mo.internal.internal_target)
+  if (NULL != esmo->base_mo.internal_target)
   {
     result = tpl_send_static_internal_message(smo, data);
   }
-	return result;
+  return result;
 }
 
 /*
- * tpl_send_zero_external_message sends a zero size message from a zero 
+ * tpl_send_zero_external_message sends a zero size message from a zero
  * external sending message object to an IPDU.
  * This function is attached to the sending message object.
  */
 FUNC(tpl_status, OS_CODE) tpl_send_zero_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data)
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
 {
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   /* cast the base mo to the correct type of mo */
   CONSTP2CONST(tpl_external_sending_zero_mo, AUTOMATIC, OS_CONST) esmo = smo;
 
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->cpu_callout())
-#endif
-    {
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->net_callout())
-#endif
-      {
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->property);
-      }
-    }
+  tpl_notify_ipdu(esmo->ipdu);
   /*
    * if at least an internal target exists, the tpl_send_zero_internal_message
    * function is called
    */
-  if (NULL != esmo->internal.internal_target)
+  if (NULL != esmo->base_mo.internal_target)
   {
     result = tpl_send_zero_internal_message(smo, data);
   }
-	return result;
+  return result;
 }
 
-FUNC(void, COM_CODE) tpl_notify_ipdu(
-  CONST(tpl_message_property, AUTOMATIC) property)
+#if WITH_COM_CYCLE == YES
+FUNC(void, OS_CODE) tpl_com_cycle_expire(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
 {
+#if SENDING_IPDU_COUNT > 0
+  VAR(uint32, AUTOMATIC) ipdu_id;
+
+  for (ipdu_id = 0; ipdu_id < SENDING_IPDU_COUNT; ipdu_id++)
+  {
+    CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_sending_ipdu_table[ipdu_id];
+    CONSTP2VAR(tpl_sending_ipdu_dyn, AUTOMATIC, OS_VAR) dyn = ipdu->dyn;
+
+    if (dyn->delay_left > 0)
+    {
+      dyn->delay_left--;
+    }
+    if ((ipdu->mode & IPDU_PERIODIC) != 0)
+    {
+      dyn->period_left--;
+      if (dyn->period_left == 0)
+      {
+        dyn->pending = TRUE;
+        dyn->period_left = ipdu->period;
+      }
+    }
+  }
+
+#if TPL_COM_BUS_CYCLE > 1
+  tpl_com_bus_cycle_left--;
+  if (tpl_com_bus_cycle_left == 0)
+  {
+    tpl_com_bus_cycle_left = TPL_COM_BUS_CYCLE;
+    tpl_com_transmit();
+  }
+#else
+  tpl_com_transmit();
+#endif
+#endif /* SENDING_IPDU_COUNT > 0 */
+
+  (void)time_obj;
+}
+#endif /* WITH_COM_CYCLE */
+
+FUNC(void, OS_CODE) tpl_com_receive_frame(
+  CONSTP2CONST(tpl_com_bus, AUTOMATIC, OS_CONST)    bus,
+  CONSTP2CONST(tpl_com_frame, AUTOMATIC, OS_VAR)    frame)
+{
+#if RECEIVING_IPDU_COUNT > 0
+  VAR(uint32, AUTOMATIC) ipdu_id = 0;
+  P2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST) ipdu = NULL;
+
+  while ((ipdu == NULL) && (ipdu_id < RECEIVING_IPDU_COUNT))
+  {
+    if ((tpl_receiving_ipdu_table[ipdu_id]->bus == bus) &&
+        (tpl_receiving_ipdu_table[ipdu_id]->id == frame->id))
+    {
+      ipdu = tpl_receiving_ipdu_table[ipdu_id];
+    }
+    ipdu_id++;
+  }
+
+  if ((ipdu != NULL) &&
+      ((ipdu->callout == NULL) || (ipdu->callout() == COM_TRUE)))
+  {
+    VAR(uint8, AUTOMATIC) i;
+    /* data of a message, tpl_message_size is at most 127 bytes */
+    VAR(tpl_com_data, AUTOMATIC) data[128];
+
+    for (i = 0; (i < ipdu->size) && (i < frame->size); i++)
+    {
+      ipdu->buffer[i] = frame->data[i];
+    }
+
+    /* unpack the network messages to the receiving message objects */
+    for (i = 0; i < ipdu->receiver_count; i++)
+    {
+      CONSTP2CONST(tpl_ipdu_receiver, AUTOMATIC, OS_CONST) receiver =
+        &(ipdu->receivers[i]);
+      CONSTP2CONST(tpl_base_receiving_mo, AUTOMATIC, OS_CONST) rmo =
+        receiver->rmo;
+      VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+      if (receiver->size > 0)
+      {
+        tpl_com_unpack(data, (uint8)receiver->size,
+                       ipdu->buffer, &(receiver->location));
+        result = ((P2CONST(tpl_data_receiving_mo, AUTOMATIC, OS_CONST))rmo)
+          ->receiver(rmo, data);
+      }
+      if ((result == E_OK) && (rmo->notification != NULL))
+      {
+        rmo->notification->action(rmo->notification);
+      }
+    }
+  }
+#else
+  (void)bus;
+  (void)frame;
+#endif
+}
+
+FUNC(void, OS_CODE) tpl_com_end_of_reception(void)
+{
+  tpl_notify_receiving_mos(FROM_IT_LEVEL);
+}
+
+FUNC(void, OS_CODE) tpl_com_start_external(void)
+{
+  VAR(uint32, AUTOMATIC) i;
+
+  for (i = 0; i < COM_BUS_COUNT; i++)
+  {
+    tpl_com_bus_table[i]->init(tpl_com_bus_table[i]);
+  }
+
+#if SENDING_IPDU_COUNT > 0
+  for (i = 0; i < SENDING_IPDU_COUNT; i++)
+  {
+    CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_sending_ipdu_table[i];
+
+    /* a null offset sends the I-PDU at the first tick */
+    ipdu->dyn->period_left = (ipdu->offset > 0) ? ipdu->offset : 1;
+    ipdu->dyn->delay_left = 0;
+    ipdu->dyn->pending = FALSE;
+  }
+#endif
+
+#if SEND_MESSAGE_COUNT > 0
+  /* pack the initial values of the messages in their I-PDU */
+  for (i = 0; i < SEND_MESSAGE_COUNT; i++)
+  {
+    if (tpl_send_message_table[i]->sender == tpl_send_static_external_message)
+    {
+      CONSTP2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST) esmo =
+        (P2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST))
+          tpl_send_message_table[i];
+
+      tpl_com_pack(esmo->ipdu->buffer, &(esmo->location),
+                   esmo->buffer.buffer, (uint8)esmo->buffer.size);
+    }
+  }
+#endif
+
+#if WITH_COM_CYCLE == YES
+  /* the COM cycle expires at each tick of the COM counter */
+  tpl_com_cycle.date = tpl_com_cycle.stat_part->counter->current_date + 1;
+  if (tpl_com_cycle.date > tpl_com_cycle.stat_part->counter->max_allowed_value)
+  {
+    tpl_com_cycle.date = 0;
+  }
+  tpl_com_cycle.state = TIME_OBJ_ACTIVE;
+  tpl_insert_time_obj(&tpl_com_cycle);
+#endif
 }
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
+#endif /* WITH_EXTERNAL_COM */
+
 /* End of file tpl_com_external_com.c */
@@ -12,25 +12,95 @@
  * $Author$
  * $URL$
  */
- 
+
 #ifndef TPL_COM_EXTERNAL_COM
 #define TPL_COM_EXTERNAL_COM
 
 #include "tpl_com_external_mo.h"
+#include "tpl_os_timeobj_kernel.h"
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/*
+ * Tables of the I-PDUs and of the buses, generated by goil
+ */
+#if SENDING_IPDU_COUNT > 0
+extern CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST)
+  tpl_sending_ipdu_table[SENDING_IPDU_COUNT];
+#endif
+#if RECEIVING_IPDU_COUNT > 0
+extern CONSTP2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST)
+  tpl_receiving_ipdu_table[RECEIVING_IPDU_COUNT];
+#endif
+extern CONSTP2CONST(tpl_com_bus, AUTOMATIC, OS_CONST)
+  tpl_com_bus_table[COM_BUS_COUNT];
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if WITH_COM_CYCLE == YES
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/*
+ * Time object of the COM counter that drives the periodic transmissions,
+ * the minimum delay times and the bus cycle. It is generated by goil.
+ */
+extern VAR(tpl_time_obj, OS_VAR) tpl_com_cycle;
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+#endif
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
 FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data);
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
 FUNC(tpl_status, OS_CODE) tpl_send_zero_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data);
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
+/*
+ * tpl_notify_ipdu is called when a triggered message is sent. According
+ * to the transmission mode of the I-PDU, the I-PDU is sent or waits for
+ * the bus cycle or the end of its minimum delay time.
+ */
+FUNC(void, OS_CODE) tpl_notify_ipdu(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu);
+
+#if WITH_COM_CYCLE == YES
+/*
+ * tpl_com_cycle_expire is the expire function of tpl_com_cycle. It is
+ * called at each tick of the COM counter.
+ */
+FUNC(void, OS_CODE) tpl_com_cycle_expire(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj);
+#endif
 
-FUNC(void, COM_CODE) tpl_notify_ipdu(
-  CONST(tpl_message_property, AUTOMATIC) property);
+/*
+ * tpl_com_receive_frame is called by a bus driver, the kernel being
+ * locked, for each frame it receives. The network messages of the
+ * I-PDU are given to the receiving message objects.
+ */
+FUNC(void, OS_CODE) tpl_com_receive_frame(
+  CONSTP2CONST(tpl_com_bus, AUTOMATIC, OS_CONST)    bus,
+  CONSTP2CONST(tpl_com_frame, AUTOMATIC, OS_VAR)    frame);
+
+/*
+ * tpl_com_end_of_reception is called by a bus driver after the frames
+ * it received. It runs the tasks notified by the messages.
+ */
+FUNC(void, OS_CODE) tpl_com_end_of_reception(void);
+
+/*
+ * tpl_com_start_external initializes the buses and starts the COM
+ * counter time object. It is called by tpl_start.
+ */
+FUNC(void, OS_CODE) tpl_com_start_external(void);
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
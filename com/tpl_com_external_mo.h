@@ -0,0 +1,69 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline external Message Object data structures
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_COM_EXTERNAL_MO_H
+#define TPL_COM_EXTERNAL_MO_H
+
+#include "tpl_com_mo.h"
+#include "tpl_com_ipdu.h"
+
+/*!
+ *  \struct TPL_EXTERNAL_SENDING_MO
+ *
+ *  \brief  Structure for external static sending message objects
+ *
+ *  The internal part allows to send the message to internal receivers
+ *  too. The buffer keeps the last value sent to the network, it is the
+ *  old value of the filter. The message is packed in the I-PDU at the
+ *  location of its network message. A triggered message triggers the
+ *  transmission of the I-PDU.
+ */
+struct TPL_EXTERNAL_SENDING_MO {
+  /*! internal part, internal_target is NULL without internal receiver */
+  tpl_internal_sending_mo                         base_mo;
+  /*! last value sent                                                   */
+  tpl_com_buffer                                  buffer;
+  /*! filter descriptor                                                 */
+  tpl_filter_desc                                 *filter;
+  /*! I-PDU the message is packed in                                    */
+  P2CONST(tpl_sending_ipdu, TYPEDEF, OS_CONST)    ipdu;
+  /*! location of the network message in the I-PDU                      */
+  tpl_net_location                                location;
+  /*! TRUE for a TRIGGERED message, FALSE for a PENDING one             */
+  tpl_bool                                        triggered;
+};
+
+typedef struct TPL_EXTERNAL_SENDING_MO tpl_external_sending_mo;
+
+/*!
+ *  \struct TPL_EXTERNAL_SENDING_ZERO_MO
+ *
+ *  \brief  Structure for external zero length sending message objects
+ *
+ *  A zero length message has no data, it triggers the transmission of
+ *  its I-PDU.
+ */
+struct TPL_EXTERNAL_SENDING_ZERO_MO {
+  /*! internal part, internal_target is NULL without internal receiver */
+  tpl_internal_sending_mo                         base_mo;
+  /*! I-PDU triggered by the message                                    */
+  P2CONST(tpl_sending_ipdu, TYPEDEF, OS_CONST)    ipdu;
+};
+
+typedef struct TPL_EXTERNAL_SENDING_ZERO_MO tpl_external_sending_zero_mo;
+
+#endif
+/*  TPL_COM_EXTERNAL_MO_H */
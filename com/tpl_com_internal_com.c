@@ -85,6 +85,52 @@ FUNC(tpl_status, OS_CODE) tpl_send_static_internal_message(
   return result;
 }
 
+/*
+ * tpl_send_static_internal_fanout_message sends a message from an internal
+ * only sending message object whose receivers are filtered together by
+ * the fan-out function of the message. Only the receivers that accept the
+ * data get it, without filtering it again.
+ * This function is attached to the sending message object.
+ */
+FUNC(tpl_status, OS_CODE) tpl_send_static_internal_fanout_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  /*  cast the base mo to the correct type of mo                          */
+  CONSTP2CONST(tpl_internal_sending_fanout_mo, AUTOMATIC, OS_CONST)
+  fmo = smo;
+  /*  get the first of the receiving mo                                   */
+  P2CONST(tpl_data_receiving_mo, AUTOMATIC, OS_CONST)
+  rmo = (tpl_data_receiving_mo *)fmo->base_mo.internal_target;
+  /*  evaluate the filters of all the receivers                           */
+  VAR(tpl_fanout_mask, AUTOMATIC) accepted = fmo->fanout(data);
+
+  while ((result == E_OK) && (accepted != 0))
+  {
+    if ((accepted & 1) != 0)
+    {
+      result = rmo->receiver(rmo, data);
+      if (result == E_OK)
+      {
+        tpl_action *notification = rmo->base_mo.notification;
+        if (notification != NULL)
+        {
+          notification->action(notification);
+        }
+      }
+    }
+    accepted >>= 1;
+    rmo = (tpl_data_receiving_mo *)rmo->base_mo.next_mo;
+  }
+
+  /*  notify the receivers    */
+  tpl_notify_receiving_mos(FROM_TASK_LEVEL);
+
+  return result;
+}
+
 /*
  * tpl_send_zero_internal_message sends a 0 length message from an internal
  * only sending message object to a set of internal receiving message objects.
@@ -157,6 +203,22 @@ FUNC(tpl_status, OS_CODE) tpl_receive_static_internal_unqueued_message(
 	return result;
 }
 
+/*
+ * tpl_receive_shared_unqueued_message is attached to the unqueued
+ * message objects that share the buffer of another one of the same
+ * sender. goil chooses the one that comes first in the receiving chain
+ * to write the buffer, the others have nothing to copy.
+ */
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_unqueued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
+{
+  (void)rmo;
+  (void)data;
+
+  return E_OK;
+}
+
 /*!
  * tpl_receive_static_internal_queued_message get a message from a data
  * buffer and copies it to the buffer of a queued message object.
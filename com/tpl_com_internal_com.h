@@ -27,6 +27,10 @@ FUNC(tpl_status, OS_CODE) tpl_send_static_internal_message(
   CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
   CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
+FUNC(tpl_status, OS_CODE) tpl_send_static_internal_fanout_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
 FUNC(tpl_status, OS_CODE) tpl_send_zero_internal_message(
   CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
   CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
@@ -35,6 +39,10 @@ FUNC(tpl_status, OS_CODE) tpl_receive_static_internal_unqueued_message(
   CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
   CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
+FUNC(tpl_status, OS_CODE) tpl_receive_shared_unqueued_message(
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
+
 FUNC(tpl_status, OS_CODE) tpl_receive_static_internal_queued_message(
   CONSTP2CONST(void, AUTOMATIC, OS_CONST)       rmo,
   CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
@@ -17,27 +17,161 @@
 #ifndef __TPL_COM_IPDU_H__
 #define __TPL_COM_IPDU_H__
 
-typedef u8  tpl_ipdu_mode;
+#include "tpl_os_std_types.h"
+#include "tpl_com_types.h"
+#include "tpl_com_base_mo.h"
+
+typedef uint8  tpl_ipdu_mode;
 
 #define IPDU_PERIODIC 1
 #define IPDU_DIRECT   2
 #define IPDU_MIXED    ((IPDU_PERIODIC) | (IPDU_DIRECT))
 
-typedef u32 tpl_ipdu_id;
+typedef uint32 tpl_ipdu_id;
+
+/*
+ * An I-PDU is at most 64 bytes long (512 bits), the size of a CAN FD frame
+ */
+#define TPL_IPDU_MAX_SIZE 64
+
+/*
+ * Representation of a network message in an I-PDU
+ */
+#define TPL_NET_BYTEARRAY       0
+#define TPL_NET_LITTLE_ENDIAN   1
+#define TPL_NET_BIG_ENDIAN      2
+
+/*
+ * A tpl_net_location gives where a network message is stored in an I-PDU:
+ * - the first byte of the message in the I-PDU
+ * - the number of bytes of the message in the I-PDU
+ * - the representation: a byte array or an unsigned integer in little or
+ *   big endian
+ */
+struct TPL_NET_LOCATION {
+  CONST(uint8, TYPEDEF)     offset;
+  CONST(uint8, TYPEDEF)     size;
+  CONST(uint8, TYPEDEF)     format;
+};
+
+typedef struct TPL_NET_LOCATION tpl_net_location;
+
+/*
+ * A tpl_com_frame is an I-PDU handed to or received from a bus driver
+ */
+struct TPL_COM_FRAME {
+  VAR(tpl_ipdu_id, TYPEDEF)                 id;
+  VAR(uint8, TYPEDEF)                       size;
+  P2CONST(uint8, TYPEDEF, OS_VAR)           data;
+};
+
+typedef struct TPL_COM_FRAME tpl_com_frame;
+
+struct TPL_COM_BUS;
+
+/*
+ * Prototype of the function of a bus driver that initializes the bus
+ */
+typedef P2FUNC(void, OS_CODE, tpl_com_bus_init_func)(
+  CONSTP2CONST(struct TPL_COM_BUS, AUTOMATIC, OS_CONST));
+
+/*
+ * Prototype of the function of a bus driver that sends a batch of frames
+ */
+typedef P2FUNC(void, OS_CODE, tpl_com_bus_send_func)(
+  CONSTP2CONST(struct TPL_COM_BUS, AUTOMATIC, OS_CONST),
+  CONSTP2CONST(tpl_com_frame, AUTOMATIC, OS_VAR),
+  CONST(uint32, AUTOMATIC));
+
+/*
+ * A tpl_com_bus is a bus the I-PDUs are sent on and received from
+ * (the LAYERUSED of the I-PDU). It gathers:
+ * - the init and send functions of the bus driver
+ * - the configuration of the bus used by the driver
+ */
+struct TPL_COM_BUS {
+  CONST(tpl_com_bus_init_func, TYPEDEF)     init;
+  CONST(tpl_com_bus_send_func, TYPEDEF)     send;
+  CONSTP2CONST(void, TYPEDEF, OS_CONST)     config;
+};
+
+typedef struct TPL_COM_BUS tpl_com_bus;
+
+/*
+ * Dynamic part of a sending I-PDU. Dates are in ticks of the COM counter
+ * - period_left: ticks before the next periodic transmission
+ * - delay_left: ticks before the minimum delay time is elapsed
+ * - pending: the I-PDU waits for a transmission
+ */
+struct TPL_SENDING_IPDU_DYN {
+  VAR(uint32, TYPEDEF)                      period_left;
+  VAR(uint32, TYPEDEF)                      delay_left;
+  VAR(tpl_bool, TYPEDEF)                    pending;
+};
+
+typedef struct TPL_SENDING_IPDU_DYN tpl_sending_ipdu_dyn;
 
 /*
  * A tpl_sending_ipdu gathers :
- * - An id
+ * - An id, the identifier of the frame on the bus
  * - A mode
- * - A 8 bytes buffer pointer
- */ 
+ * - The size and the buffer of the I-PDU
+ * - The period, the offset and the minimum delay time in ticks of the
+ *   COM counter
+ * - A pointer to the dynamic part
+ * - The bus
+ * - The IPDUCALLOUT or NULL
+ */
 struct TPL_SENDING_IPDU {
-  CONST(tpl_ipdu_id, TYPEDEF)      id;
-  CONST(tpl_ipdu_mode, TYPEDEF)    mode;
-  CONSTP2VAR(u8, TYPEDEF, COM_VAR) buffer;
+  CONST(tpl_ipdu_id, TYPEDEF)                     id;
+  CONST(tpl_ipdu_mode, TYPEDEF)                   mode;
+  CONST(uint8, TYPEDEF)                           size;
+  CONSTP2VAR(uint8, TYPEDEF, OS_VAR)              buffer;
+  CONST(uint32, TYPEDEF)                          period;
+  CONST(uint32, TYPEDEF)                          offset;
+  CONST(uint32, TYPEDEF)                          min_delay;
+  CONSTP2VAR(tpl_sending_ipdu_dyn, TYPEDEF, OS_VAR) dyn;
+  CONSTP2CONST(tpl_com_bus, TYPEDEF, OS_CONST)    bus;
+  CONST(tpl_com_callout, TYPEDEF)                 callout;
 };
 
 typedef struct TPL_SENDING_IPDU tpl_sending_ipdu;
 
+/*
+ * A tpl_ipdu_receiver is a receiving message object fed by a network
+ * message of a receiving I-PDU:
+ * - the location of the network message in the I-PDU
+ * - the receiving message object
+ * - the size of the CDATATYPE of the message object, 0 for a zero
+ *   length message
+ */
+struct TPL_IPDU_RECEIVER {
+  CONST(tpl_net_location, TYPEDEF)                      location;
+  CONSTP2CONST(tpl_base_receiving_mo, TYPEDEF, OS_CONST) rmo;
+  CONST(tpl_message_size, TYPEDEF)                      size;
+};
+
+typedef struct TPL_IPDU_RECEIVER tpl_ipdu_receiver;
+
+/*
+ * A tpl_receiving_ipdu gathers :
+ * - An id, the identifier of the frame on the bus
+ * - The size and the buffer of the I-PDU
+ * - The receiving message objects fed by the I-PDU
+ * - The bus
+ * - The IPDUCALLOUT or NULL
+ */
+struct TPL_RECEIVING_IPDU {
+  CONST(tpl_ipdu_id, TYPEDEF)                           id;
+  CONST(uint8, TYPEDEF)                                 size;
+  CONSTP2VAR(uint8, TYPEDEF, OS_VAR)                    buffer;
+  CONSTP2CONST(tpl_ipdu_receiver, TYPEDEF, OS_CONST)    receivers;
+  CONST(uint8, TYPEDEF)                                 receiver_count;
+  CONSTP2CONST(tpl_com_bus, TYPEDEF, OS_CONST)          bus;
+  CONST(tpl_com_callout, TYPEDEF)                       callout;
+};
+
+typedef struct TPL_RECEIVING_IPDU tpl_receiving_ipdu;
+
 /*  __TPL_COM_IPDU_H__  */
-#endif
\ No newline at end of file
+#endif
@@ -42,6 +42,9 @@
 /*#if COM_EXTENDED == YES*/
 #include "tpl_com_internal_com.h"
 /*#endif*/
+#if WITH_EXTERNAL_COM == YES
+#include "tpl_com_external_com.h"
+#endif
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -35,6 +35,33 @@ typedef struct TPL_INTERNAL_SENDING_MO tpl_internal_sending_mo;
 
 typedef tpl_internal_sending_mo tpl_internal_sending_zero_mo;
 
+/*
+ * tpl_fanout_mask is the set of receivers of a message that accept the
+ * data: bit i for the i-th receiving message object of the chain.
+ */
+typedef uint32 tpl_fanout_mask;
+
+/*
+ * A fan-out function evaluates the filters of all the receivers of a
+ * message in one pass. It is generated by goil for the message.
+ */
+typedef P2FUNC(tpl_fanout_mask, OS_CODE, tpl_fanout_func)(
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR));
+
+/*
+ * tpl_internal_sending_fanout_mo is an internal only sending message
+ * object whose receivers are filtered by a fan-out function. The filter
+ * pointers of the receivers are NULL.
+ */
+struct TPL_INTERNAL_SENDING_FANOUT_MO {
+  /*  common to all internal sending mo                   */
+  tpl_internal_sending_mo         base_mo;
+  /*  filters of the receivers                            */
+  tpl_fanout_func                 fanout;
+};
+
+typedef struct TPL_INTERNAL_SENDING_FANOUT_MO tpl_internal_sending_fanout_mo;
+
 /*!
  *  \struct tpl_internal_receiving_zero_mo
  *
@@ -1,6986 +0,0 @@
-/**
- * @file MemMap.h
- *
- * @section desc File description
- *
- * Memory mapping using gcc __attribute__
- * Memory Mapping of Application lonely
- * Automatically generated by goil on Fri Apr  1 15:02:06 2016
- * from root OIL file lonely.oil
- *
- * @section copyright Copyright
- *
- * Trampoline OS
- *
- * Trampoline is copyright (c) IRCCyN 2005-2007
- * Trampoline is protected by the French intellectual property law.
- *
- * This software is distributed under the Lesser GNU Public Licence
- *
- * @section infos File informations
- *
- * $Date$
- * $Rev$
- * $Author$
- * $URL$
- */
-
-#define MEMMAP_ERROR
-
-/*=============================================================================
- * OS memory mapping
- *
- * Code section
- */
-#ifdef OS_START_SEC_CODE
-  #undef OS_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a .osCode while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".osCode")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-
-#ifdef OS_STOP_SEC_CODE
-  #undef OS_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section .osCode started"
-  #endif
-#endif
-
-
-#ifdef OS_START_SEC_VAR_NOINIT_32BIT
-  #undef OS_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_NOINIT_32BIT
-  #undef OS_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_NOINIT_16BIT
-  #undef OS_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_NOINIT_16BIT
-  #undef OS_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_NOINIT_8BIT
-  #undef OS_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_NOINIT_8BIT
-  #undef OS_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef OS_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef OS_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef OS_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef OS_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef OS_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef OS_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef OS_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef OS_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef OS_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef OS_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef OS_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef OS_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef OS_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef OS_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_FAST_32BIT
-  #undef OS_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_FAST_32BIT
-  #undef OS_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_FAST_16BIT
-  #undef OS_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_FAST_16BIT
-  #undef OS_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_FAST_8BIT
-  #undef OS_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_FAST_8BIT
-  #undef OS_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_FAST_BOOLEAN
-  #undef OS_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef OS_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef OS_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef OS_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_32BIT
-  #undef OS_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_32BIT
-  #undef OS_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_16BIT
-  #undef OS_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_16BIT
-  #undef OS_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_8BIT
-  #undef OS_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_8BIT
-  #undef OS_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_BOOLEAN
-  #undef OS_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_BOOLEAN
-  #undef OS_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_VAR_UNSPECIFIED
-  #undef OS_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osVar data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osVar")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_VAR_UNSPECIFIED
-  #undef OS_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef OS_START_SEC_CONST_32BIT
-  #undef OS_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONST_32BIT
-  #undef OS_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONST_16BIT
-  #undef OS_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONST_16BIT
-  #undef OS_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONST_8BIT
-  #undef OS_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONST_8BIT
-  #undef OS_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONST_BOOLEAN
-  #undef OS_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONST_BOOLEAN
-  #undef OS_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONST_UNSPECIFIED
-  #undef OS_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONST_UNSPECIFIED
-  #undef OS_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CALIB_32BIT
-  #undef OS_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CALIB_32BIT
-  #undef OS_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CALIB_16BIT
-  #undef OS_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CALIB_16BIT
-  #undef OS_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CALIB_8BIT
-  #undef OS_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CALIB_8BIT
-  #undef OS_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CALIB_BOOLEAN
-  #undef OS_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CALIB_BOOLEAN
-  #undef OS_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CALIB_UNSPECIFIED
-  #undef OS_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CALIB_UNSPECIFIED
-  #undef OS_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CARTO_32BIT
-  #undef OS_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CARTO_32BIT
-  #undef OS_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CARTO_16BIT
-  #undef OS_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CARTO_16BIT
-  #undef OS_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CARTO_8BIT
-  #undef OS_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CARTO_8BIT
-  #undef OS_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CARTO_BOOLEAN
-  #undef OS_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CARTO_BOOLEAN
-  #undef OS_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CARTO_UNSPECIFIED
-  #undef OS_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CARTO_UNSPECIFIED
-  #undef OS_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONFIG_DATA_32BIT
-  #undef OS_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONFIG_DATA_32BIT
-  #undef OS_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONFIG_DATA_16BIT
-  #undef OS_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONFIG_DATA_16BIT
-  #undef OS_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONFIG_DATA_8BIT
-  #undef OS_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONFIG_DATA_8BIT
-  #undef OS_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef OS_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef OS_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef OS_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef OS_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osConst data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef OS_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef OS_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-
-/*=============================================================================
- * API code and const memory mapping
- */
-#ifdef API_START_SEC_CODE
-  #undef API_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a .osApiCode section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".osApiCode")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-
-#ifdef API_STOP_SEC_CODE
-  #undef API_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section .osApiCode started"
-  #endif
-#endif
-
-#ifdef API_START_SEC_CONST_UNSPECIFIED
-  #undef API_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a .osApiConst section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".osApiConst")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-
-#ifdef API_STOP_SEC_CONST_UNSPECIFIED
-  #undef API_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section .osApiConst started"
-  #endif
-#endif
-
-/*============================================================================
- * Common library
- */
-#ifdef APP_COMMON_START_SEC_CODE
-  #undef APP_COMMON_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a .appCommonCode section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".appCommonCode")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-
-#ifdef APP_COMMON_STOP_SEC_CODE
-  #undef APP_COMMON_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section .appCommonCode started"
-  #endif
-#endif
-
-/*=============================================================================
- * Application objects (Tasks and ISRs) Memory mapping
- */
-
-
-
-/*-----------------------------------------------------------------------------
- * Task task1 memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_Task_task1_START_SEC_CODE
-  #undef APP_Task_task1_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new task1 Task code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".Task_task1Code")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CODE
-  #undef APP_Task_task1_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_Task_task1_START_SEC_STACK
-  #undef APP_Task_task1_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new task1 Task stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1Stack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_STACK
-  #undef APP_Task_task1_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_Task_task1_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task1_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task1_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task1_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task1_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task1_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task1_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task1_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task1_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_32BIT
-  #undef APP_Task_task1_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_32BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_16BIT
-  #undef APP_Task_task1_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_16BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_8BIT
-  #undef APP_Task_task1_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_8BIT
-  #undef APP_Task_task1_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_BOOLEAN
-  #undef APP_Task_task1_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_Task_task1_START_SEC_CONST_32BIT
-  #undef APP_Task_task1_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONST_32BIT
-  #undef APP_Task_task1_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONST_16BIT
-  #undef APP_Task_task1_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONST_16BIT
-  #undef APP_Task_task1_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONST_8BIT
-  #undef APP_Task_task1_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONST_8BIT
-  #undef APP_Task_task1_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONST_BOOLEAN
-  #undef APP_Task_task1_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONST_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CALIB_32BIT
-  #undef APP_Task_task1_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CALIB_32BIT
-  #undef APP_Task_task1_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CALIB_16BIT
-  #undef APP_Task_task1_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CALIB_16BIT
-  #undef APP_Task_task1_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CALIB_8BIT
-  #undef APP_Task_task1_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CALIB_8BIT
-  #undef APP_Task_task1_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task1_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CARTO_32BIT
-  #undef APP_Task_task1_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CARTO_32BIT
-  #undef APP_Task_task1_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CARTO_16BIT
-  #undef APP_Task_task1_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CARTO_16BIT
-  #undef APP_Task_task1_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CARTO_8BIT
-  #undef APP_Task_task1_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CARTO_8BIT
-  #undef APP_Task_task1_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task1_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task1_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task1_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task1_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task1_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task1_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task1_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task1_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task1_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task1_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task1_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task1_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task1_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task1_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*-----------------------------------------------------------------------------
- * Task task2 memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_Task_task2_START_SEC_CODE
-  #undef APP_Task_task2_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new task2 Task code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".Task_task2Code")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CODE
-  #undef APP_Task_task2_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_Task_task2_START_SEC_STACK
-  #undef APP_Task_task2_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new task2 Task stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2Stack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_STACK
-  #undef APP_Task_task2_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_Task_task2_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task2_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task2_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task2_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task2_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task2_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task2_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task2_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task2_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_32BIT
-  #undef APP_Task_task2_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_32BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_16BIT
-  #undef APP_Task_task2_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_16BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_8BIT
-  #undef APP_Task_task2_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_8BIT
-  #undef APP_Task_task2_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_BOOLEAN
-  #undef APP_Task_task2_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_Task_task2_START_SEC_CONST_32BIT
-  #undef APP_Task_task2_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONST_32BIT
-  #undef APP_Task_task2_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONST_16BIT
-  #undef APP_Task_task2_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONST_16BIT
-  #undef APP_Task_task2_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONST_8BIT
-  #undef APP_Task_task2_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONST_8BIT
-  #undef APP_Task_task2_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONST_BOOLEAN
-  #undef APP_Task_task2_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONST_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CALIB_32BIT
-  #undef APP_Task_task2_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CALIB_32BIT
-  #undef APP_Task_task2_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CALIB_16BIT
-  #undef APP_Task_task2_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CALIB_16BIT
-  #undef APP_Task_task2_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CALIB_8BIT
-  #undef APP_Task_task2_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CALIB_8BIT
-  #undef APP_Task_task2_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task2_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CARTO_32BIT
-  #undef APP_Task_task2_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CARTO_32BIT
-  #undef APP_Task_task2_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CARTO_16BIT
-  #undef APP_Task_task2_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CARTO_16BIT
-  #undef APP_Task_task2_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CARTO_8BIT
-  #undef APP_Task_task2_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CARTO_8BIT
-  #undef APP_Task_task2_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task2_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task2_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task2_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task2_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task2_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task2_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task2_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task2_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task2_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task2_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task2_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task2_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task2_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task2_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*-----------------------------------------------------------------------------
- * Task task3 memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_Task_task3_START_SEC_CODE
-  #undef APP_Task_task3_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new task3 Task code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".Task_task3Code")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CODE
-  #undef APP_Task_task3_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_Task_task3_START_SEC_STACK
-  #undef APP_Task_task3_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new task3 Task stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3Stack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_STACK
-  #undef APP_Task_task3_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_Task_task3_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task3_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task3_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task3_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task3_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task3_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task3_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task3_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task3_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_32BIT
-  #undef APP_Task_task3_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_32BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_16BIT
-  #undef APP_Task_task3_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_16BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_8BIT
-  #undef APP_Task_task3_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_8BIT
-  #undef APP_Task_task3_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_BOOLEAN
-  #undef APP_Task_task3_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_Task_task3_START_SEC_CONST_32BIT
-  #undef APP_Task_task3_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONST_32BIT
-  #undef APP_Task_task3_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONST_16BIT
-  #undef APP_Task_task3_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONST_16BIT
-  #undef APP_Task_task3_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONST_8BIT
-  #undef APP_Task_task3_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONST_8BIT
-  #undef APP_Task_task3_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONST_BOOLEAN
-  #undef APP_Task_task3_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONST_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CALIB_32BIT
-  #undef APP_Task_task3_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CALIB_32BIT
-  #undef APP_Task_task3_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CALIB_16BIT
-  #undef APP_Task_task3_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CALIB_16BIT
-  #undef APP_Task_task3_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CALIB_8BIT
-  #undef APP_Task_task3_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CALIB_8BIT
-  #undef APP_Task_task3_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task3_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CARTO_32BIT
-  #undef APP_Task_task3_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CARTO_32BIT
-  #undef APP_Task_task3_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CARTO_16BIT
-  #undef APP_Task_task3_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CARTO_16BIT
-  #undef APP_Task_task3_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CARTO_8BIT
-  #undef APP_Task_task3_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CARTO_8BIT
-  #undef APP_Task_task3_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task3_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task3_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_task3_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task3_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_task3_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task3_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_task3_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task3_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_task3_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_task3_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task3_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task task3 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_task3_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_task3_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_task3_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*-----------------------------------------------------------------------------
- * ISR isr_button2 memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_ISR_isr_button2_START_SEC_CODE
-  #undef APP_ISR_isr_button2_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new isr_button2 ISR code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".ISR_isr_button2Code")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CODE
-  #undef APP_ISR_isr_button2_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_ISR_isr_button2_START_SEC_STACK
-  #undef APP_ISR_isr_button2_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new isr_button2 ISR stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2Stack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_STACK
-  #undef APP_ISR_isr_button2_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_FAST_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_FAST_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_FAST_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_VAR_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONST_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONST_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONST_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONST_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONST_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONST_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONST_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONST_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONST_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CALIB_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CALIB_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CALIB_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CALIB_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CALIB_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CALIB_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CALIB_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CARTO_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CARTO_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CARTO_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CARTO_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CARTO_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CARTO_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CARTO_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_ISR_isr_button2_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button2 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button2_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_ISR_isr_button2_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*-----------------------------------------------------------------------------
- * ISR isr_button1 memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_ISR_isr_button1_START_SEC_CODE
-  #undef APP_ISR_isr_button1_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new isr_button1 ISR code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".ISR_isr_button1Code")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CODE
-  #undef APP_ISR_isr_button1_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_ISR_isr_button1_START_SEC_STACK
-  #undef APP_ISR_isr_button1_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new isr_button1 ISR stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1Stack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_STACK
-  #undef APP_ISR_isr_button1_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_FAST_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_FAST_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_FAST_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_VAR_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONST_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONST_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONST_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONST_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONST_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONST_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONST_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONST_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONST_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CALIB_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CALIB_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CALIB_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CALIB_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CALIB_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CALIB_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CALIB_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CARTO_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CARTO_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CARTO_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CARTO_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CARTO_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CARTO_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CARTO_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_ISR_isr_button1_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new ISR isr_button1 data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".ISR_isr_button1_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_ISR_isr_button1_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-
-/*-----------------------------------------------------------------------------
- * Task IDLE_TASK memory mapping to sections
- *
- * Code section
- */
-#ifdef APP_Task_IDLE_TASK_START_SEC_CODE
-  #undef APP_Task_IDLE_TASK_START_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #error "Starting a new IDLE_TASK Task code section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASKCode")))
-    #define CURRENT_LINKER_CODE_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CODE
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CODE
-  #ifdef CURRENT_LINKER_CODE_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_CODE_SECTION
-    #undef CURRENT_LINKER_CODE_SECTION_NAME
-    #define CURRENT_LINKER_CODE_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Stack section
- */
-#ifdef APP_Task_IDLE_TASK_START_SEC_STACK
-  #undef APP_Task_IDLE_TASK_START_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new IDLE_TASK Task stack section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASKStack")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_STACK
-  #undef APP_Task_IDLE_TASK_STOP_SEC_STACK
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-/*
- * Variables sections
- */
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_NOINIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_NOINIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_NOINIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_NOINIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_NOINIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_NOINIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_POWER_ON_INIT_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_POWER_ON_INIT_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_POWER_ON_INIT_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_POWER_ON_INIT_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_POWER_ON_INIT_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_POWER_ON_INIT_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_FAST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_FAST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_FAST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_FAST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_FAST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_FAST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_VAR_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_VAR_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_VAR_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-/*
- * Const, Calibration, Carto, Configuration data sections
- */
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONST_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONST_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONST_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONST_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONST_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONST_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONST_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONST_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONST_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONST_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONST_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONST_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONST_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONST_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONST_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONST_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONST_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONST_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONST_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CALIB_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CALIB_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CALIB_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CALIB_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CALIB_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CALIB_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CALIB_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CALIB_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CALIB_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CALIB_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CALIB_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CALIB_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CALIB_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CALIB_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CALIB_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CALIB_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CALIB_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CALIB_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CALIB_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CARTO_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CARTO_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CARTO_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CARTO_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CARTO_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CARTO_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CARTO_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CARTO_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CARTO_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CARTO_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CARTO_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CARTO_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CARTO_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CARTO_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CARTO_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CARTO_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CARTO_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CARTO_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CARTO_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONFIG_DATA_32BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_32BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_32BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONFIG_DATA_16BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_16BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_16BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONFIG_DATA_8BIT")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_8BIT
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_8BIT
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONFIG_DATA_BOOLEAN")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_BOOLEAN
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-#ifdef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_START_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #error "Starting a new Task IDLE_TASK data section while a section is already started"
-  #else
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME __attribute__ ((section (".Task_IDLE_TASK_SEC_CONFIG_DATA_UNSPECIFIED")))
-    #define CURRENT_LINKER_DATA_SECTION
-  #endif
-#endif
-#ifdef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #undef APP_Task_IDLE_TASK_STOP_SEC_CONFIG_DATA_UNSPECIFIED
-  #ifdef CURRENT_LINKER_DATA_SECTION
-    #undef MEMMAP_ERROR
-    #undef CURRENT_LINKER_DATA_SECTION
-    #undef CURRENT_LINKER_DATA_SECTION_NAME
-    #define CURRENT_LINKER_DATA_SECTION_NAME
-  #else
-    #error "No section started"
-  #endif
-#endif
-
-
-#ifdef MEMMAP_ERROR
-  #error "MemMap.h, wrong section command"
-#endif
-
-/*=============================================================================
- * Published informations
- */
-#define MEMMAP_VENDOR_ID        48
-#define MEMMAP_AR_MAJOR_VERSION 3
-#define MEMMAP_AR_MINOR_VERSION 0
-#define MEMMAP_AR_PATCH_VERSION 0
-#define MEMMAP_SW_MAJOR_VERSION 1
-#define MEMMAP_SW_MINOR_VERSION 0
-#define MEMMAP_SW_PATCH_VERSION 0
-
@@ -0,0 +1,59 @@
+/*
+ * External COM on the shared memory bus, sending side. Every 10 ms the
+ * flood task sends a burst of samples. A sample is a TRIGGERED message
+ * so each one sends sample_pdu, with the pending sequence number packed
+ * next to it. status_pdu is sent every 100 ms with the last status.
+ * Start ecu_b first, then ecu_a, in two shells of the same host:
+ *
+ *   ../ecu_b/ecu_b_exe
+ *   ./ecu_a_exe
+ *
+ * Change BUSCYCLE in ecu_a.oil to compare the frame rate and the wakeups
+ * of ecu_b with batched transmissions.
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+#include "tpl_posix_shm_bus.h"
+
+#define BURST 20
+
+DeclareMessage(sample);
+DeclareMessage(sequence);
+DeclareMessage(status);
+
+static uint32 sequence_number = 0;
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(flood)
+{
+  int i;
+  uint32 value;
+
+  for (i = 0; i < BURST; i++)
+  {
+    sequence_number++;
+    value = sequence_number * 3;
+    SendMessage(sequence, &sequence_number);
+    SendMessage(sample, &value);
+  }
+  SendMessage(status, &sequence_number);
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  tpl_shm_bus_stats stats;
+
+  if (tpl_shm_bus_get_stats("can", &stats))
+  {
+    printf("%llu frames sent in %llu batches, %u samples\n",
+           stats.frames_sent, stats.batches_sent,
+           (unsigned int)sequence_number);
+  }
+  ShutdownOS(E_OK);
+}
@@ -0,0 +1,64 @@
+/*
+ * External COM on the shared memory bus, receiving side. The frames of
+ * ecu_a are unpacked in the sample, sequence and status messages when
+ * the bus signal is received. Every second the report task prints the
+ * frames received in the last second, the latency between the write of
+ * a frame by ecu_a and its reception by the COM, the frames lost by an
+ * overflow of the ring and the wakeups (bus signals handled).
+ * Start ecu_b first, then ecu_a (see ../ecu_a/ecu_a.c).
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+#include "tpl_posix_shm_bus.h"
+
+DeclareMessage(sample);
+DeclareMessage(sequence);
+DeclareMessage(status);
+
+static unsigned int status_count = 0;
+static tpl_shm_bus_stats last;
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(on_status)
+{
+  status_count++;
+  TerminateTask();
+}
+
+TASK(report)
+{
+  tpl_shm_bus_stats stats;
+  unsigned long long frames;
+  uint32 last_sample = 0;
+  uint32 last_sequence = 0;
+
+  if (tpl_shm_bus_get_stats("can", &stats))
+  {
+    ReceiveMessage(sample, &last_sample);
+    ReceiveMessage(sequence, &last_sequence);
+    frames = stats.frames_received - last.frames_received;
+    printf("%llu frames/s, %llu wakeups/s", frames,
+           stats.wakeups - last.wakeups);
+    if (frames > 0)
+    {
+      printf(", latency avg %llu ns (min %llu, max %llu)",
+             (stats.latency_sum - last.latency_sum) / frames,
+             stats.latency_min, stats.latency_max);
+    }
+    printf(", %llu lost, sequence %u, sample %u, %u status\n",
+           stats.frames_lost, (unsigned int)last_sequence,
+           (unsigned int)last_sample, status_count);
+    last = stats;
+  }
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  ShutdownOS(E_OK);
+}
@@ -0,0 +1,156 @@
+/*
+ * Utilisation benchmark of the EDF band against fixed priorities.
+ *
+ * Two periodic tasks, fast (period 10 ticks) and slow (period 14 ticks),
+ * have a deadline equal to their period. Their execution times keep the
+ * ratio 4/8 and are scaled so that the total load goes from 60% to 100%
+ * in steps of 5%. Each load level lasts 5 hyperperiods (350 ticks). The
+ * controller task, above the periodic tasks, prints the number of missed
+ * deadlines of each level and the background task, below them, counts
+ * the loops it does in the spare time.
+ *
+ * edf.oil puts fast and slow in the EDF band, rm.oil gives them rate
+ * monotonic priorities. The admitted load of a policy is the highest load
+ * level without missed deadlines. The response time analysis of this task
+ * set gives 84.9% for rate monotonic (slow is preempted twice by fast, so
+ * 8s + 2 * 4s <= 14 with s = load / 97) and 100% for EDF, minus the
+ * kernel overhead: rate monotonic should miss deadlines from the 85%
+ * level, EDF only at 100%. A level where EDF misses deadlines below 100%
+ * points to a wrong deadline order in the band.
+ *
+ * first compilation:
+ * goil --target=posix --templates=../../../goil/templates/ edf.oil
+ * or
+ * goil --target=posix --templates=../../../goil/templates/ rm.oil
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+
+#define FAST_PERIOD   10
+#define SLOW_PERIOD   14
+#define HYPERPERIOD   70
+#define LEVEL_LENGTH  (5 * HYPERPERIOD)
+#define FIRST_RELEASE 100
+#define FIRST_LOAD    60
+#define LAST_LOAD     100
+#define LOAD_STEP     5
+
+/*
+ * At 100% of load, fast runs 4 * 100 / 97 ticks and slow 8 * 100 / 97
+ * ticks since 4/10 + 8/14 = 97%
+ */
+#define FAST_COST_AT_FULL_LOAD  400
+#define SLOW_COST_AT_FULL_LOAD  800
+#define BASE_LOAD               97
+
+static volatile unsigned long date = 0;
+static volatile unsigned long loops_per_tick = 0;
+static volatile unsigned long fast_loops = 0;
+static volatile unsigned long slow_loops = 0;
+static volatile unsigned long background_loops = 0;
+static unsigned long fast_jobs = 0;
+static unsigned long slow_jobs = 0;
+static unsigned long fast_misses = 0;
+static unsigned long slow_misses = 0;
+static unsigned int load = FIRST_LOAD;
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+/*
+ * The date is the number of ticks of the SystemCounter
+ */
+ALARMCALLBACK(count_tick)
+{
+  date++;
+}
+
+static void work(unsigned long loops)
+{
+  volatile unsigned long i;
+  for (i = 0; i < loops; i++);
+}
+
+/*
+ * Runs a job released at release and tells if it ends after its deadline
+ */
+static int job(unsigned long release, unsigned long period,
+               unsigned long loops)
+{
+  work(loops);
+  return (date - release) > period;
+}
+
+static void set_costs(void)
+{
+  fast_loops = loops_per_tick * FAST_COST_AT_FULL_LOAD * load /
+               (BASE_LOAD * 100);
+  slow_loops = loops_per_tick * SLOW_COST_AT_FULL_LOAD * load /
+               (BASE_LOAD * 100);
+}
+
+/*
+ * Counts the loops of work done in 10 ticks
+ */
+TASK(calibrate)
+{
+  unsigned long start = date;
+  unsigned long loops = 0;
+
+  while (date == start);
+  start = date;
+  while ((date - start) < 10)
+  {
+    work(100);
+    loops += 100;
+  }
+  loops_per_tick = loops / 10;
+  set_costs();
+  printf("%lu loops per tick\n", loops_per_tick);
+  printf("load  fast misses  slow misses  background loops\n");
+  TerminateTask();
+}
+
+TASK(fast)
+{
+  unsigned long release = FIRST_RELEASE + fast_jobs * FAST_PERIOD;
+  fast_jobs++;
+  fast_misses += job(release, FAST_PERIOD, fast_loops);
+  TerminateTask();
+}
+
+TASK(slow)
+{
+  unsigned long release = FIRST_RELEASE + slow_jobs * SLOW_PERIOD;
+  slow_jobs++;
+  slow_misses += job(release, SLOW_PERIOD, slow_loops);
+  TerminateTask();
+}
+
+TASK(controller)
+{
+  printf("%3u%%  %11lu  %11lu  %16lu\n",
+         load, fast_misses, slow_misses, background_loops);
+  fast_misses = 0;
+  slow_misses = 0;
+  background_loops = 0;
+  if (load >= LAST_LOAD)
+  {
+    ShutdownOS(E_OK);
+  }
+  load += LOAD_STEP;
+  set_costs();
+  TerminateTask();
+}
+
+TASK(background)
+{
+  while (1)
+  {
+    work(100);
+    background_loops++;
+  }
+}
@@ -17,7 +17,7 @@ TASK(receiver)
   rcv_message = 0;
 #if IOC_UNQUEUED_COUNT > 0
   IocRead_my_ioc_name(&rcv_message);
-#elif IOC_QUEUED_COUNT > 0
+#else
   IocReceive_my_ioc_name(&rcv_message);
 #endif
   printf("Receiver Task Reads : #%d\n", rcv_message);
@@ -29,7 +29,7 @@ TASK(sender)
   snd_message++;
 #if IOC_UNQUEUED_COUNT > 0
   IocWrite_my_ioc_name(snd_message);
-#elif IOC_QUEUED_COUNT > 0
+#else
   IocSend_my_ioc_name(snd_message);
 #endif
   printf("! Sender Task Sends : #%d\n", snd_message);
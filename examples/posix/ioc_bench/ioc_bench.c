@@ -0,0 +1,74 @@
+/*
+ * Read-heavy bench of the LAST_IS_BEST IOCs on the POSIX target.
+ *
+ * The writer task writes a new value in both IOCs every 10 ms. Every
+ * second the reader task reads each IOC READS times: locked goes
+ * through the IOCRead system call and the kernel lock, lock_free is
+ * read by the task itself with a sequence counter (LOCK_FREE = TRUE).
+ * The bench prints the time per read and checks that the values read
+ * never go backwards. It stops after ROUNDS rounds.
+ */
+#include <stdio.h>
+#include <time.h>
+#include "Os.h"
+
+#define READS   1000000
+#define ROUNDS  5
+
+static uint32 value = 0;
+static unsigned int round_count = 0;
+
+static unsigned long long now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(writer)
+{
+  value++;
+  IocWrite_locked(value);
+  IocWrite_lock_free(value);
+  TerminateTask();
+}
+
+TASK(reader)
+{
+  unsigned long long start, locked_ns, lock_free_ns;
+  unsigned int i, backwards = 0;
+  uint32 read, last = 0;
+
+  start = now_ns();
+  for (i = 0; i < READS; i++) {
+    IocRead_locked(&read);
+    if (read < last) backwards++;
+    last = read;
+  }
+  locked_ns = now_ns() - start;
+
+  last = 0;
+  start = now_ns();
+  for (i = 0; i < READS; i++) {
+    IocRead_lock_free(&read);
+    if (read < last) backwards++;
+    last = read;
+  }
+  lock_free_ns = now_ns() - start;
+
+  printf("read: %llu ns locked, %llu ns lock free, %u out of order, value %u\n",
+         locked_ns / READS, lock_free_ns / READS, backwards,
+         (unsigned int)last);
+
+  round_count++;
+  if (round_count == ROUNDS) {
+    ShutdownOS(E_OK);
+  }
+  TerminateTask();
+}
@@ -0,0 +1,48 @@
+/*
+ * Three ISRs on interrupt lines carried by real time signals. Viper raises
+ * each line periodically and each ISR counts its interrupts. After 2s the
+ * stop task prints the counts.
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+#include "tpl_viper_interface.h"
+
+static volatile unsigned int door_count = 0;
+static volatile unsigned int window_count = 0;
+static volatile unsigned int crash_count = 0;
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(start)
+{
+  tpl_viper_start_auto_irq_line(5, 100000);    /* 100 ms */
+  tpl_viper_start_auto_irq_line(40, 250000);   /* 250 ms */
+  tpl_viper_start_one_shot_irq_line(200, 1500000);
+  TerminateTask();
+}
+
+ISR(door)
+{
+  door_count++;
+}
+
+ISR(window)
+{
+  window_count++;
+}
+
+ISR(crash)
+{
+  crash_count++;
+}
+
+TASK(stop)
+{
+  printf("door: %u, window: %u, crash: %u\n",
+         door_count, window_count, crash_count);
+  ShutdownOS(E_OK);
+}
@@ -0,0 +1,91 @@
+/*
+ * Replay of an interrupt timeline by viper. Before starting the OS, main
+ * writes a timeline of 1s: a CAN controller raises line 1 at 20kHz with
+ * the identifier of the received frame as payload and a sensor raises
+ * line 2 every millisecond. The start task asks viper to replay it. The
+ * ISRs count their interrupts and the stop task prints the counts after
+ * 2s. Viper prints the missed deadlines and the achieved rate on stderr
+ * at the end of the replay.
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+#include "tpl_viper_interface.h"
+#include "viper.h"
+
+#define TIMELINE_FILE   "/tmp/irq_replay.ev"
+#define CAN_PERIOD      50000UL     /* ns */
+#define SENSOR_PERIOD   1000000UL   /* ns */
+#define DURATION        1000000000UL
+
+static volatile unsigned int can_count = 0;
+static volatile unsigned int can_id_errors = 0;
+static volatile unsigned int sensor_count = 0;
+
+/*
+ * Writes the timeline. The records are sorted by date.
+ */
+static int write_timeline(void)
+{
+  FILE *f = fopen(TIMELINE_FILE, "wb");
+  vp_event_header header;
+  vp_event_record record;
+  uint64_t date;
+
+  if (f == NULL) {
+    perror(TIMELINE_FILE);
+    return 0;
+  }
+  header.magic = VP_EVENT_MAGIC;
+  header.version = VP_EVENT_VERSION;
+  header.count = DURATION / CAN_PERIOD + DURATION / SENSOR_PERIOD;
+  fwrite(&header, sizeof(header), 1, f);
+  for (date = 0; date < DURATION; date += CAN_PERIOD) {
+    record.date = date;
+    record.line = 1;
+    record.payload = (uint32_t)((date / CAN_PERIOD) & 0x7FF);
+    fwrite(&record, sizeof(record), 1, f);
+    if (date % SENSOR_PERIOD == 0) {
+      record.line = 2;
+      record.payload = 0;
+      fwrite(&record, sizeof(record), 1, f);
+    }
+  }
+  fclose(f);
+  return 1;
+}
+
+int main(void)
+{
+  if (write_timeline()) {
+    StartOS(OSDEFAULTAPPMODE);
+  }
+  return 0;
+}
+
+TASK(start)
+{
+  /* an event later than 100us misses its deadline */
+  tpl_viper_play_events(TIMELINE_FILE, 0, 100);
+  TerminateTask();
+}
+
+ISR(can_rx)
+{
+  /* the frames are numbered modulo 2048 */
+  if (tpl_viper_irq_payload() != (can_count & 0x7FF)) {
+    can_id_errors++;
+  }
+  can_count++;
+}
+
+ISR(sensor)
+{
+  sensor_count++;
+}
+
+TASK(stop)
+{
+  printf("can_rx: %u (%u out of order), sensor: %u\n",
+         can_count, can_id_errors, sensor_count);
+  ShutdownOS(E_OK);
+}
@@ -0,0 +1,65 @@
+/*
+ * Interrupt and alarm latency histograms. Viper raises the sensor line
+ * every 1 ms and three alarms activate tasks of different priorities;
+ * background runs 5 ms so logger is often delayed. After 3 s the stop
+ * task dumps the histograms in latency.txt. Print them with:
+ *
+ *   ../../../machines/posix/latency_report.py latency.txt
+ */
+#include <stdio.h>
+#include <time.h>
+#include "tpl_os.h"
+#include "tpl_viper_interface.h"
+
+static volatile unsigned int sensor_count = 0;
+
+static void busy(long ms)
+{
+  struct timespec start, now;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  do {
+    clock_gettime(CLOCK_MONOTONIC, &now);
+  } while ((now.tv_sec - start.tv_sec) * 1000L +
+           (now.tv_nsec - start.tv_nsec) / 1000000L < ms);
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(start)
+{
+  tpl_viper_start_auto_irq_line(1, 1000);    /* 1 ms */
+  TerminateTask();
+}
+
+ISR(sensor)
+{
+  sensor_count++;
+}
+
+TASK(control)
+{
+  TerminateTask();
+}
+
+TASK(logger)
+{
+  TerminateTask();
+}
+
+TASK(background)
+{
+  busy(5);
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  printf("%u sensor interrupts\n", sensor_count);
+  DumpLatency();
+  ShutdownOS(E_OK);
+}
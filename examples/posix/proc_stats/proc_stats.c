@@ -0,0 +1,76 @@
+/*
+ * Runtime statistics of two periodic tasks. fast runs 1 ms every 10 ms
+ * and preempts slow, which runs 15 ms every 50 ms. After 5 seconds,
+ * report prints what GetProcStats gives for both tasks and the idle
+ * time, in nanoseconds.
+ *
+ * The same counters are exported in proc_stats.orti as the vs_ attributes
+ * of the tasks.
+ */
+#include <stdio.h>
+#include <time.h>
+#include "tpl_os.h"
+
+static unsigned long long now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void busy(unsigned long long duration)
+{
+  unsigned long long start = now_ns();
+  while (now_ns() - start < duration);
+}
+
+static void print_stats(const char *name, TaskType proc_id)
+{
+  ProcStatsType stats;
+
+  if (GetProcStats(proc_id, &stats) != E_OK) {
+    printf("%s: no statistics\n", name);
+    return;
+  }
+  printf("%-6s %5lu jobs %5lu preemptions", name,
+         (unsigned long)stats.jobs, (unsigned long)stats.preemptions);
+  if (stats.jobs > 0) {
+    printf(" exec %llu/%llu/%llu response %llu/%llu/%llu (min/avg/max)",
+           (unsigned long long)stats.exec_min,
+           (unsigned long long)(stats.exec_sum / stats.jobs),
+           (unsigned long long)stats.exec_max,
+           (unsigned long long)stats.response_min,
+           (unsigned long long)(stats.response_sum / stats.jobs),
+           (unsigned long long)stats.response_max);
+  }
+  else {
+    printf(" exec total %llu", (unsigned long long)stats.exec_sum);
+  }
+  printf("\n");
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(fast)
+{
+  busy(1000000);
+  TerminateTask();
+}
+
+TASK(slow)
+{
+  busy(15000000);
+  TerminateTask();
+}
+
+TASK(report)
+{
+  print_stats("fast", fast);
+  print_stats("slow", slow);
+  print_stats("idle", IDLE_TASK_ID);
+  ShutdownOS(E_OK);
+}
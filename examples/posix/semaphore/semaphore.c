@@ -0,0 +1,61 @@
+/*
+ * low takes the bus semaphore, then high and urgent block on it. low
+ * inherits their priority so medium, activated meanwhile, does not run
+ * before low posts the semaphore. urgent gets the semaphore before high
+ * because the wait queue is ordered by priority. The expected output is:
+ *
+ * low takes bus
+ * high waits bus
+ * urgent waits bus
+ * low posts bus
+ * urgent takes bus
+ * high takes bus
+ * medium runs
+ * low ends
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(low)
+{
+  SemWait(bus);
+  printf("low takes bus\n");
+  ActivateTask(high);
+  /* low runs with the priority of high, medium waits */
+  ActivateTask(medium);
+  ActivateTask(urgent);
+  printf("low posts bus\n");
+  SemPost(bus);
+  printf("low ends\n");
+  ShutdownOS(E_OK);
+}
+
+TASK(medium)
+{
+  printf("medium runs\n");
+  TerminateTask();
+}
+
+TASK(high)
+{
+  printf("high waits bus\n");
+  SemWait(bus);
+  printf("high takes bus\n");
+  SemPost(bus);
+  TerminateTask();
+}
+
+TASK(urgent)
+{
+  printf("urgent waits bus\n");
+  SemWait(bus);
+  printf("urgent takes bus\n");
+  SemPost(bus);
+  TerminateTask();
+}
@@ -0,0 +1,110 @@
+/*
+ * Cost of the services called with a constant object on the POSIX target.
+ *
+ * The bench task calls CALLS times each of ActivateTask, SetEvent,
+ * GetResource and SetRelAlarm with an object of the OIL file, first
+ * through the generic service, then through the variant goil generates
+ * in tpl_os.h for that object (ActivateTask_nop(), ...), which does not
+ * check the id. GetResource is paired with ReleaseResource and
+ * SetRelAlarm with CancelAlarm. The bench prints the time per call in
+ * ns and the number of calls that did not return E_OK.
+ * Set WHOLE_PROGRAM to UNITY or LTO in service_bench.oil to compare the
+ * time per call and the code size (size service_bench_exe) with the
+ * kernel compiled with the application.
+ */
+#include <stdio.h>
+#include <time.h>
+#include "tpl_os.h"
+
+#define CALLS   200000
+
+static unsigned int errors = 0;
+
+static unsigned long long now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void check(StatusType status)
+{
+  if (status != E_OK) errors++;
+}
+
+static void report(const char *service, unsigned long long generic_ns,
+                   unsigned long long static_ns)
+{
+  printf("%-12s %6llu ns generic, %6llu ns constant id\n", service,
+         generic_ns / CALLS, static_ns / CALLS);
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(bench)
+{
+  unsigned long long start, generic_ns;
+  unsigned int i;
+
+  /* nop has a higher priority: each activation runs it */
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) check(ActivateTask(nop));
+  generic_ns = now_ns() - start;
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) check(ActivateTask_nop());
+  report("ActivateTask", generic_ns, now_ns() - start);
+
+  /* waiter has a lower priority and waits for ev: no rescheduling */
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) check(SetEvent(waiter, ev));
+  generic_ns = now_ns() - start;
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) check(SetEvent_waiter(ev));
+  report("SetEvent", generic_ns, now_ns() - start);
+
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) {
+    check(GetResource(shared));
+    check(ReleaseResource(shared));
+  }
+  generic_ns = now_ns() - start;
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) {
+    check(GetResource_shared());
+    check(ReleaseResource(shared));
+  }
+  report("GetResource", generic_ns, now_ns() - start);
+
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) {
+    check(SetRelAlarm(later, 100, 0));
+    check(CancelAlarm(later));
+  }
+  generic_ns = now_ns() - start;
+  start = now_ns();
+  for (i = 0; i < CALLS; i++) {
+    check(SetRelAlarm_later(100, 0));
+    check(CancelAlarm(later));
+  }
+  report("SetRelAlarm", generic_ns, now_ns() - start);
+
+  printf("%u errors\n", errors);
+  ShutdownOS(E_OK);
+}
+
+TASK(nop)
+{
+  TerminateTask();
+}
+
+TASK(waiter)
+{
+  while (1) {
+    WaitEvent(ev);
+    ClearEvent(ev);
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Shared stacks. goil gives one stack to the basic tasks that can never
+ * be started at the same time: sensor_a, sensor_b and sensor_c have the
+ * same priority, control runs at their priority with its internal
+ * resource and logger is non-preemptable, so the five of them share one
+ * 32768 bytes stack. start and stop preempt them and display waits for
+ * an event, they keep their own stack. The groups are described in
+ * shared_stacks/tpl_app_config.c and the peak usage of the stacks is
+ * written in measured_stack.oil at shutdown.
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+
+static volatile unsigned int samples = 0;
+static volatile unsigned int refreshes = 0;
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(start)
+{
+  ActivateTask(sensor_a);
+  ActivateTask(sensor_b);
+  ActivateTask(sensor_c);
+  TerminateTask();
+}
+
+TASK(sensor_a)
+{
+  samples++;
+  TerminateTask();
+}
+
+TASK(sensor_b)
+{
+  samples++;
+  TerminateTask();
+}
+
+TASK(sensor_c)
+{
+  samples++;
+  TerminateTask();
+}
+
+TASK(control)
+{
+  /* sensor_a is started after control terminates */
+  ActivateTask(sensor_a);
+  TerminateTask();
+}
+
+TASK(logger)
+{
+  printf("%u samples, %u refreshes\n", samples, refreshes);
+  TerminateTask();
+}
+
+TASK(display)
+{
+  while (1) {
+    WaitEvent(refresh);
+    ClearEvent(refresh);
+    refreshes++;
+  }
+}
+
+TASK(stop)
+{
+  ShutdownOS(E_OK);
+}
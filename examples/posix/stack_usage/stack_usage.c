@@ -0,0 +1,66 @@
+/*
+ * Stack high water marks. The stacks are painted at startup and the peak
+ * usage of each task and ISR2 is written at shutdown in
+ * measured_stack.oil, an OIL fragment included by stack_usage.oil. The
+ * next goil run reads it back and writes the recommended STACKSIZE of
+ * each task and ISR2, with a 25% margin, in stack_usage/stack_sizes.txt.
+ * The recommendation for shallow is far under its 16384 bytes.
+ *
+ * The build also bounds each stack from the call graph given by gcc
+ * (BUILD::STACK_ANALYSIS) in stack_bounds.txt, before any run. The
+ * recursion of deep can not be bounded, it is reported as UNBOUNDED.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "tpl_os.h"
+#include "tpl_viper_interface.h"
+
+static volatile unsigned int sensor_count = 0;
+
+/* each level uses a bit more than 64 bytes of stack */
+static unsigned int recurse(unsigned int depth)
+{
+  volatile unsigned char frame[64];
+
+  memset((void *)frame, (int)depth, sizeof(frame));
+  if (depth == 0) {
+    return frame[0];
+  }
+  return frame[depth % sizeof(frame)] + recurse(depth - 1);
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(start)
+{
+  tpl_viper_start_auto_irq_line(1, 5000);    /* 5 ms */
+  TerminateTask();
+}
+
+ISR(sensor)
+{
+  sensor_count++;
+}
+
+TASK(deep)
+{
+  recurse(150);
+  TerminateTask();
+}
+
+TASK(shallow)
+{
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  printf("%u sensor interrupts\n", sensor_count);
+  DumpStackUsage();
+  printf("stack usage written in measured_stack.oil\n");
+  ShutdownOS(E_OK);
+}
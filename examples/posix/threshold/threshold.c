@@ -0,0 +1,43 @@
+/*
+ * low activates medium then high. high preempts low at once, medium
+ * runs after low terminates. The expected output is:
+ *
+ * low starts
+ * high runs
+ * low ends
+ * medium runs
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(low)
+{
+  printf("low starts\n");
+  ActivateTask(medium);
+  ActivateTask(high);
+  printf("low ends\n");
+  TerminateTask();
+}
+
+TASK(medium)
+{
+  printf("medium runs\n");
+  TerminateTask();
+}
+
+TASK(high)
+{
+  printf("high runs\n");
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  ShutdownOS(E_OK);
+}
@@ -0,0 +1,96 @@
+/*
+ * Overhead and accuracy of the timing protection on the POSIX target.
+ *
+ * The bench task activates an empty job LOOPS times, then the same job
+ * with an execution budget. Each start of the protected job arms its
+ * watchdog and each termination cancels it, so the difference of the
+ * two loops is the cost of the timing protection per activation.
+ *
+ * Then the overrun task busy waits longer than its 50us budget, ROUNDS
+ * times. The ProtectionHook measures how late the watchdog expired
+ * after the budget.
+ */
+#include <stdio.h>
+#include <time.h>
+#include "tpl_os.h"
+
+#define LOOPS   100000
+#define ROUNDS  100
+#define BUDGET  50000ULL   /* ns, EXECUTIONBUDGET of overrun */
+
+static unsigned long long overrun_start;
+static unsigned long long late_sum = 0;
+static unsigned long long late_max = 0;
+static unsigned int expirations = 0;
+
+static unsigned long long now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static unsigned long long loop_ns(TaskType job)
+{
+  unsigned long long start = now_ns();
+  unsigned int i;
+  for (i = 0; i < LOOPS; i++) {
+    ActivateTask(job);
+  }
+  return (now_ns() - start) / LOOPS;
+}
+
+int main(void)
+{
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+ProtectionReturnType ProtectionHook(StatusType Fatalerror)
+{
+  unsigned long long late = now_ns() - overrun_start - BUDGET;
+  if (Fatalerror == E_OS_PROTECTION_TIME) {
+    expirations++;
+    late_sum += late;
+    if (late > late_max) late_max = late;
+  }
+  return PRO_TERMINATETASKISR;
+}
+
+TASK(bench)
+{
+  unsigned long long plain, protected;
+  unsigned int round;
+
+  plain = loop_ns(job);
+  protected = loop_ns(protected_job);
+  printf("activation: %llu ns, with timing protection: %llu ns, overhead: %lld ns\n",
+         plain, protected, (long long)protected - (long long)plain);
+
+  for (round = 0; round < ROUNDS; round++) {
+    ActivateTask(overrun);
+  }
+  printf("%u/%u budgets of %llu ns caught, late by %llu ns on average, %llu ns at most\n",
+         expirations, ROUNDS, BUDGET,
+         expirations ? late_sum / expirations : 0, late_max);
+
+  ShutdownOS(E_OK);
+}
+
+TASK(job)
+{
+  TerminateTask();
+}
+
+TASK(protected_job)
+{
+  TerminateTask();
+}
+
+TASK(overrun)
+{
+  overrun_start = now_ns();
+  /* the watchdog stops this loop */
+  while (now_ns() - overrun_start < 100 * BUDGET);
+  TerminateTask();
+}
@@ -0,0 +1,44 @@
+/*
+ * Runtime trace filtering. Tracing is compiled in but starts disabled.
+ * The start task records the task events of sensor only, one out of 4,
+ * so trace.txt gets a quarter of the events of sensor and none of
+ * display and of the alarms.
+ *
+ * While it runs, the filter may be changed from the host, for instance:
+ *
+ *   echo "procs on" > /tmp/viper.trace.<pid of trace_filter_exe>
+ *   echo "sample 1" > /tmp/viper.trace.<pid of trace_filter_exe>
+ */
+#include <stdio.h>
+#include <unistd.h>
+#include "tpl_os.h"
+
+int main(void)
+{
+  printf("trace control: /tmp/viper.trace.%d\n", (int)getpid());
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(start)
+{
+  SetTraceProc(TRACE_ALL_PROCS, FALSE);
+  SetTraceProc(sensor, TRUE);
+  SetTraceFilter(TRACE_CLASSES_TASK, 4);
+  TerminateTask();
+}
+
+TASK(sensor)
+{
+  TerminateTask();
+}
+
+TASK(display)
+{
+  TerminateTask();
+}
+
+TASK(stop)
+{
+  ShutdownOS(E_OK);
+}
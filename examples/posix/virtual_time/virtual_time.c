@@ -0,0 +1,40 @@
+/*
+ * Ten minutes of alarms in virtual time. Viper moves the date to the
+ * next tick each time the application is idle, so the run takes a
+ * fraction of a second. The checksum depends on the order the two tasks
+ * run in and is the same at each run.
+ */
+#include <stdio.h>
+#include "tpl_os.h"
+#include "tpl_viper_interface.h"
+
+#define DURATION 600  /* seconds */
+
+static unsigned int seconds = 0;
+static unsigned int samples = 0;
+static unsigned long checksum = 0;
+
+int main(void)
+{
+    StartOS(OSDEFAULTAPPMODE);
+    return 0;
+}
+
+TASK(clock)
+{
+  seconds++;
+  checksum = checksum * 31 + 1;
+  if (seconds == DURATION) {
+    printf("%u s, %u samples, virtual date %llu ns, checksum %lx\n",
+           seconds, samples, tpl_viper_get_date(), checksum);
+    ShutdownOS(E_OK);
+  }
+  TerminateTask();
+}
+
+TASK(sample)
+{
+  samples++;
+  checksum = checksum * 31 + 2;
+  TerminateTask();
+}
@@ -0,0 +1,177 @@
+/**
+ * @file core_state_bench/core_state_bench.c
+ *
+ * @section desc File description
+ *
+ * Microbenchmark of the kernel services that only write the state of
+ * the calling core.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "Os.h"
+#include "tpl_os.h"
+
+/* Number of windows after which the benchmark is over */
+#define WINDOW_COUNT 10
+
+/*
+ * The loop counters of the cores are one cache line apart so that the
+ * benchmark does not add false sharing of its own.
+ */
+#define COUNTER_STRIDE 8
+
+DeclareTask(worker_0);
+DeclareTask(job_0);
+DeclareTask(worker_1);
+DeclareTask(job_1);
+DeclareTask(window);
+
+/* TRUE when the worker of core 1 runs, FALSE when it waits */
+volatile VAR(boolean, AUTOMATIC) core1_runs = FALSE;
+
+/* Loops done by each core during the current window */
+volatile VAR(uint32, AUTOMATIC) loops[2 * COUNTER_STRIDE];
+
+/*
+ * Loops done by core 0 in each window. Core 1 is idle in even windows
+ * and runs the same loop in odd ones.
+ */
+VAR(uint32, AUTOMATIC) loops_per_window[WINDOW_COUNT];
+VAR(uint32, AUTOMATIC) window_index = 0;
+
+#define APP_COMMON_START_SEC_CODE
+#include "tpl_memmap.h"
+
+int main(void)
+{
+  StatusType rv;
+
+  switch(GetCoreID()){
+    case OS_CORE_ID_MASTER :
+      initLed();
+      setLed(0, 0);
+      setLed(1, 0);
+      /* Wakeup core 1 */
+      StartCore(OS_CORE_ID_1, &rv);
+      if(rv == E_OK)
+        StartOS(OSDEFAULTAPPMODE);
+      break;
+    case OS_CORE_ID_1 :
+      StartOS(OSDEFAULTAPPMODE);
+      break;
+    default :
+      /* Should not happen */
+      break;
+  }
+  return 0;
+}
+
+/*
+ * One loop updates the lock counters, the ready list and the tpl_kern
+ * of the calling core only.
+ */
+void one_loop(TaskType job)
+{
+  SuspendOSInterrupts();
+  ResumeOSInterrupts();
+  ActivateTask(job);
+  loops[GetCoreID() * COUNTER_STRIDE]++;
+}
+
+#define APP_COMMON_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_worker_0_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(worker_0)
+{
+  while (window_index < WINDOW_COUNT)
+  {
+    one_loop(job_0);
+  }
+  setLed(0, 1);
+  TerminateTask();
+}
+#define APP_Task_worker_0_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_job_0_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(job_0)
+{
+  TerminateTask();
+}
+#define APP_Task_job_0_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_worker_1_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(worker_1)
+{
+  while (window_index < WINDOW_COUNT)
+  {
+    if (core1_runs)
+    {
+      one_loop(job_1);
+    }
+  }
+  TerminateTask();
+}
+#define APP_Task_worker_1_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_job_1_START_SEC_CODE
+#include "tpl_memmap.h"
+TASK(job_1)
+{
+  TerminateTask();
+}
+#define APP_Task_job_1_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_window_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ * Records the loops of core 0 and starts or stops the worker of core 1
+ */
+TASK(window)
+{
+  if (window_index < WINDOW_COUNT)
+  {
+    loops_per_window[window_index] = loops[0];
+    loops[0] = 0;
+    window_index++;
+    core1_runs = !core1_runs;
+    setLed(1, core1_runs);
+  }
+  TerminateTask();
+}
+#define APP_Task_window_STOP_SEC_CODE
+#include "tpl_memmap.h"
@@ -0,0 +1,190 @@
+/**
+ * @file stm_bench/stm_bench.c
+ *
+ * @section desc File description
+ *
+ * Read-mostly benchmark of the STM-HRT against a spinlock protected data.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "Os.h"
+#include "tpl_os.h"
+
+/* Number of windows after which the benchmark is over */
+#define WINDOW_COUNT 10
+
+DeclareSpinlock(spin_pair);
+
+DeclareTask(writer);
+DeclareTask(reader);
+DeclareTask(window);
+
+/* The pair protected by spin_pair. The STM pair is stm_x/stm_y */
+VAR(uint32, AUTOMATIC) spin_x = 0;
+VAR(uint32, AUTOMATIC) spin_y = 0;
+
+/* TRUE when the reader uses the STM, FALSE when it uses the spinlock */
+volatile VAR(boolean, AUTOMATIC) use_stm = TRUE;
+
+/* Reads done during the current window */
+volatile VAR(uint32, AUTOMATIC) reads = 0;
+/* Read-set transactions that had to be retried during the current window */
+volatile VAR(uint32, AUTOMATIC) retries = 0;
+/* Inconsistent pairs read, should stay at 0 */
+volatile VAR(uint32, AUTOMATIC) errors = 0;
+
+/* Results, indexed by window. Even windows use the STM */
+VAR(uint32, AUTOMATIC) reads_per_window[WINDOW_COUNT];
+VAR(uint32, AUTOMATIC) retries_per_window[WINDOW_COUNT];
+VAR(uint32, AUTOMATIC) window_index = 0;
+
+#define APP_COMMON_START_SEC_CODE
+#include "tpl_memmap.h"
+
+int main(void)
+{
+  StatusType rv;
+
+  switch(GetCoreID()){
+    case OS_CORE_ID_MASTER :
+      initLed();
+      setLed(0, 0);
+      setLed(1, 0);
+      /* Wakeup core 1 */
+      StartCore(OS_CORE_ID_1, &rv);
+      if(rv == E_OK)
+        StartOS(OSDEFAULTAPPMODE);
+      break;
+    case OS_CORE_ID_1 :
+      StartOS(OSDEFAULTAPPMODE);
+      break;
+    default :
+      /* Should not happen */
+      break;
+  }
+  return 0;
+}
+
+#define APP_COMMON_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_writer_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ * The writer updates both pairs so that x == y holds for a consistent read
+ */
+TASK(writer)
+{
+  uint32 value;
+
+  STMBeginWriteTx();
+  STMOpenReadObject(obj_x, &value);
+  value++;
+  STMOpenWriteObject(obj_x, &value);
+  STMOpenWriteObject(obj_y, &value);
+  STMCommitWriteTx();
+
+  GetSpinlock(spin_pair);
+  spin_x++;
+  spin_y = spin_x;
+  ReleaseSpinlock(spin_pair);
+
+  TerminateTask();
+}
+#define APP_Task_writer_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_reader_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ * The reader reads the pairs as fast as it can in background
+ */
+TASK(reader)
+{
+  uint32 x;
+  uint32 y;
+
+  while (window_index < WINDOW_COUNT)
+  {
+    if (use_stm)
+    {
+      STMBeginReadTx();
+      STMOpenReadObject(obj_x, &x);
+      STMOpenReadObject(obj_y, &y);
+      while (STMCommitReadTx() != E_OK)
+      {
+        retries++;
+        STMBeginReadTx();
+        STMOpenReadObject(obj_x, &x);
+        STMOpenReadObject(obj_y, &y);
+      }
+      STMEndReadTx();
+    }
+    else
+    {
+      GetSpinlock(spin_pair);
+      x = spin_x;
+      y = spin_y;
+      ReleaseSpinlock(spin_pair);
+    }
+    if (x != y)
+    {
+      errors++;
+    }
+    reads++;
+  }
+
+  setLed(0, errors == 0);
+  TerminateTask();
+}
+#define APP_Task_reader_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#define APP_Task_window_START_SEC_CODE
+#include "tpl_memmap.h"
+/*
+ * Records the reads of the window and switches the protocol used
+ */
+TASK(window)
+{
+  if (window_index < WINDOW_COUNT)
+  {
+    reads_per_window[window_index] = reads;
+    retries_per_window[window_index] = retries;
+    reads = 0;
+    retries = 0;
+    window_index++;
+    use_stm = !use_stm;
+    setLed(1, use_stm);
+  }
+  TerminateTask();
+}
+#define APP_Task_window_STOP_SEC_CODE
+#include "tpl_memmap.h"
@@ -0,0 +1,119 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline AUTOSAR lock free IOC
+ *
+ * A lock free IOC does not go through the kernel. goil generates its
+ * storage and its functions in tpl_ioc_api_config.c.
+ *
+ * A LAST_IS_BEST IOC with LOCK_FREE = TRUE has a sequence counter and
+ * two copies of the data (double buffering). The sequence counter is
+ * 2v when version v of the data is stable in copy v & 1, and 2v + 1
+ * while the only writer fills copy (v + 1) & 1. So a reader copies the
+ * last stable version while a write is in progress, and retries only
+ * when a second write started to overwrite the copy it was reading (the
+ * counter moved by 3 or more). Writers never wait and no kernel lock is
+ * taken, on any core.
+ *
+ * A QUEUED IOC with one SENDER, one RECEIVER and LOCK_FREE = TRUE is a
+ * single producer, single consumer ring. The sender
+ * only writes the head index, the receiver only writes the tail index,
+ * so both are wait free. The slots are a power of two so a free running
+ * index is masked, but the ring holds at most BUFFER_LENGTH elements.
+ * A send to a full ring counts an overflow, and the next receive
+ * returns IOC_E_LOST_DATA when it sees a count it has not reported yet.
+ * The tasks of the sender (resp. the receiver) must not preempt one
+ * another in the middle of a call.
+ *
+ * $Date$ - $Rev$
+ * $Author$
+ * $URL$
+ */
+/* MISRA RULE 3.1 VIOLATION: special character is used in comments for svn integration, the code can survive to this ! */
+
+#ifndef __TPL_IOC_LOCK_FREE_H__
+#define __TPL_IOC_LOCK_FREE_H__
+
+#include "tpl_ioc.h"
+
+/**
+ * @typedef tpl_ioc_sequence
+ *
+ * sequence counter of a lock free IOC
+ */
+typedef uint32 tpl_ioc_sequence;
+
+/**
+ * @def TPL_IOC_BARRIER
+ *
+ * Full memory barrier between the accesses to the sequence counter and
+ * the accesses to the data. It is also a compiler barrier. A port may
+ * define its own before including this file.
+ */
+#ifndef TPL_IOC_BARRIER
+#define TPL_IOC_BARRIER() __sync_synchronize()
+#endif
+
+/**
+ * @def TPL_IOC_WRITE_COPY
+ *
+ * Copy written while the sequence counter is seq (even, stable)
+ */
+#define TPL_IOC_WRITE_COPY(seq) ((((seq) >> 1) + 1U) & 1U)
+
+/**
+ * @def TPL_IOC_READ_COPY
+ *
+ * Copy of the last stable version when the sequence counter is seq
+ */
+#define TPL_IOC_READ_COPY(seq)  (((seq) >> 1) & 1U)
+
+/**
+ * @def TPL_IOC_TORN
+ *
+ * TRUE when the copy read between the sequence counter values first and
+ * last may have been overwritten by a write.
+ */
+#define TPL_IOC_TORN(first, last) \
+  ((tpl_ioc_sequence)((last) - ((first) & ~(tpl_ioc_sequence)1U)) >= 3U)
+
+/**
+ * @def TPL_IOC_CACHE_LINE
+ *
+ * Size of a cache line. The indices of the sender and of the receiver
+ * of a ring are kept in different lines.
+ */
+#ifndef TPL_IOC_CACHE_LINE
+#define TPL_IOC_CACHE_LINE 64
+#endif
+
+/**
+ * @struct TPL_IOC_RING
+ *
+ * Indices of a single producer, single consumer ring. head and tail are
+ * free running: the ring is empty when they are equal.
+ */
+struct TPL_IOC_RING
+{
+  /* written by the sender only */
+  volatile VAR(uint32, TYPEDEF) head;
+  volatile VAR(uint32, TYPEDEF) overflows;
+  VAR(uint8, TYPEDEF)           head_pad[TPL_IOC_CACHE_LINE - (2 * sizeof(uint32))];
+  /* written by the receiver only */
+  volatile VAR(uint32, TYPEDEF) tail;
+  VAR(uint32, TYPEDEF)          overflows_seen;
+  VAR(uint8, TYPEDEF)           tail_pad[TPL_IOC_CACHE_LINE - (2 * sizeof(uint32))];
+};
+
+/**
+ * @typedef tpl_ioc_ring
+ */
+typedef struct TPL_IOC_RING tpl_ioc_ring;
+
+/*  __TPL_IOC_LOCK_FREE_H__ */
+#endif
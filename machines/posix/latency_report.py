@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+# Prints the latency histograms written by DumpLatency on the POSIX target
+# (see tpl_dump_latency in tpl_machine_posix.c).
+#
+# usage: latency_report.py [latency.txt]
+#
+# Bucket 0 counts the null latencies and bucket b > 0 the latencies from
+# 2^(b-1) to 2^b - 1 ns, so a percentile is given as the upper bound of
+# the bucket it falls in.
+
+import sys
+
+PERCENTILES = (50, 90, 99, 99.9)
+BAR_WIDTH = 50
+
+
+def bucket_bounds(bucket):
+    if bucket == 0:
+        return (0, 0)
+    return (1 << (bucket - 1), (1 << bucket) - 1)
+
+
+def pretty_ns(ns):
+    for unit, scale in (("s", 1000000000), ("ms", 1000000), ("us", 1000)):
+        if ns >= scale:
+            return "%.1f%s" % (ns / scale, unit)
+    return "%dns" % ns
+
+
+def percentile_bucket(counts, total, percentile):
+    threshold = total * percentile / 100.0
+    seen = 0
+    for bucket, count in enumerate(counts):
+        seen += count
+        if seen >= threshold:
+            return bucket
+    return len(counts) - 1
+
+
+def report(kind, name, counts):
+    total = sum(counts)
+    print("%s %s: %d samples" % (kind, name, total))
+    if total == 0:
+        return
+    used = [b for b, count in enumerate(counts) if count > 0]
+    print("  " + ", ".join(
+        "p%g <= %s" % (p, pretty_ns(bucket_bounds(
+            percentile_bucket(counts, total, p))[1]))
+        for p in PERCENTILES) +
+        ", max <= %s" % pretty_ns(bucket_bounds(used[-1])[1]))
+    peak = max(counts)
+    for bucket in range(used[0], used[-1] + 1):
+        low, high = bucket_bounds(bucket)
+        bar = "#" * ((counts[bucket] * BAR_WIDTH + peak - 1) // peak)
+        print("  %8s - %-8s %10d %s" % (pretty_ns(low), pretty_ns(high),
+                                        counts[bucket], bar))
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else "latency.txt"
+    with open(path) as dump:
+        for line in dump:
+            fields = line.split()
+            if not fields or fields[0].startswith("#"):
+                continue
+            report(fields[0], fields[1], [int(f) for f in fields[2:]])
+
+
+if __name__ == "__main__":
+    main()
@@ -41,6 +41,18 @@ extern void tpl_sleep(void);
 #define IDLE_STACK      &idle_task_stack
 #define IDLE_STACK_SIZE 32768
 
+/*
+ * The stacks are painted with OS_STACK_PATTERN when their usage is
+ * measured or monitored (see tpl_init_machine)
+ */
+#define OS_STACK_PATTERN 0xDEADBEEF
+
+/*
+ * The timing protection has one POSIX timer per core and per watchdog
+ * kind (see tpl_posix_autosar.c)
+ */
+#define TPL_TP_WATCHDOG_PER_KIND
+
 /* TODO : This function is called after an ISR2 has been terminated. It should
  *        restore the hardware's cpu priority if it has been increased before
  *        the execution of the ISR2 (see ppc/multicore/tpl_machine.h for an
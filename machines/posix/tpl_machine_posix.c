@@ -20,6 +20,9 @@
 #include "tpl_machine_interface.h"
 #include "tpl_os.h"
 #include "tpl_os_application_def.h" /* define NO_ISR if needed. */
+#if WITH_LATENCY == YES
+#include "tpl_os_latency_kernel.h"
+#endif
 #if WITH_AUTOSAR == YES
 #include "tpl_as_isr_kernel.h"
 #include "tpl_os_kernel.h" /* for tpl_running_obj */
@@ -37,15 +40,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <sys/types.h>
 #include <unistd.h>
 #include <sys/wait.h>
 
 #include "tpl_machine_posix.h"
-
-extern volatile int tpl_locking_depth;
-extern char tpl_user_task_lock;
-extern char tpl_cpt_os_task_lock;
+#if WITH_EXTERNAL_COM == YES
+#include "tpl_posix_shm_bus.h"
+#endif
 
 #if TASK_COUNT > 0
 extern FUNC(void, OS_CODE) CallTerminateTask(void);
@@ -58,16 +61,31 @@ extern FUNC(void, OS_CODE) CallTerminateISR2(void);
 extern void viper_kill(void);
 
 /*
- * idle_function is used by the idle task
+ * idle_function is used by the idle task. In virtual time, the idle
+ * task asks viper for the next event instead of waiting for it and the
+ * OS shuts down when no event is pending anymore.
  */
 void idle_function(void)
 {
+#if WITH_POSIX_VIRTUAL_TIME == YES
+    while(tpl_viper_advance());
+    fprintf(stderr, "Virtual time: no pending event at %llu ns\n",
+            tpl_viper_get_date());
+    ShutdownOS(E_OK);
+#else
     while(1) pause();
+#endif
 }
 
 void tpl_shutdown(void)
 {
     tpl_posix_sigblock("tpl_shutdown_failed");
+#if WITH_STACK_REPORT == YES
+    tpl_dump_stack_usage();
+#endif
+#if WITH_EXTERNAL_COM == YES
+    tpl_shm_bus_shutdown();
+#endif
     viper_kill();
 
     exit(0);
@@ -187,6 +205,160 @@ void quit(int n)
     ShutdownOS(E_OK);
 }
 
+#if WITH_STATS == YES
+/*
+ * The statistics are in nanoseconds of the monotonic clock of the host
+ */
+FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_time(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (tpl_stats_time)now.tv_sec * 1000000000ULL
+           + (tpl_stats_time)now.tv_nsec;
+}
+#endif /* WITH_STATS */
+
+#if WITH_LATENCY == YES
+static void tpl_dump_histogram(
+    FILE *file, const char *kind, const char *name, const uint32 *histogram)
+{
+    int bucket;
+
+    fprintf(file, "%s %s", kind, name);
+    for (bucket = 0; bucket < TPL_LATENCY_BUCKETS; bucket++) {
+        fprintf(file, " %lu", (unsigned long)histogram[bucket]);
+    }
+    fprintf(file, "\n");
+}
+
+/*
+ * The histograms are written in TPL_LATENCY_FILE, one line per ISR2 and
+ * per alarm: the kind, the name and the counts of the buckets. The file
+ * is rewritten at each dump. latency_report.py prints it.
+ */
+FUNC(void, OS_CODE) tpl_dump_latency(void)
+{
+    FILE *file = fopen(TPL_LATENCY_FILE, "w");
+    unsigned int id;
+
+    if (file == NULL) {
+        perror("tpl_dump_latency: " TPL_LATENCY_FILE);
+        return;
+    }
+    fprintf(file, "# trampoline latency, ns, %d log2 buckets\n",
+            TPL_LATENCY_BUCKETS);
+#if ISR_COUNT > 0
+    for (id = 0; id < ISR_COUNT; id++) {
+        tpl_dump_histogram(file, "isr", proc_name_table[TASK_COUNT + id],
+                           tpl_isr_latency[id]);
+    }
+#endif
+#if ALARM_COUNT > 0
+    for (id = 0; id < ALARM_COUNT; id++) {
+        tpl_dump_histogram(file, "alarm", tpl_alarm_name_table[id],
+                           tpl_alarm_latency[id]);
+    }
+#endif
+    (void)id;
+    fclose(file);
+}
+#endif /* WITH_LATENCY */
+
+#if WITH_SHARED_STACKS == YES
+/*
+ * First process of the stack of proc_id. The basic tasks that are never
+ * started at the same time share their stack (see SHARED_STACKS in the
+ * OS object).
+ */
+static tpl_proc_id tpl_stack_owner(tpl_proc_id proc_id)
+{
+    tpl_proc_id owner = 0;
+
+    while (tpl_stat_proc_table[owner]->stack !=
+           tpl_stat_proc_table[proc_id]->stack) {
+        owner++;
+    }
+    return owner;
+}
+#endif /* WITH_SHARED_STACKS */
+
+#if (WITH_PAINT_STACK == YES) || (WITH_STACK_REPORT == YES) || \
+    (WITH_STACK_MONITORING == YES)
+/*
+ * The stacks grow down from the end of their zone. They are painted
+ * before the contexts are created, so the words still painted at the
+ * bottom of a zone have never been used.
+ */
+static void tpl_paint_stack(const struct TPL_STACK *stack)
+{
+    tpl_stack_word *word = stack->stack_zone;
+    tpl_stack_word *const end =
+        word + (stack->stack_size / sizeof(tpl_stack_word));
+
+    while (word < end) {
+        *word++ = OS_STACK_PATTERN;
+    }
+}
+#endif
+
+#if WITH_STACK_REPORT == YES
+/*
+ * Peak usage of a stack in bytes: the scan stops at the first word that
+ * is not painted anymore
+ */
+static uint32 tpl_stack_usage(const struct TPL_STACK *stack)
+{
+    const tpl_stack_word *word = stack->stack_zone;
+    const tpl_stack_word *const end =
+        word + (stack->stack_size / sizeof(tpl_stack_word));
+
+    while ((word < end) && (*word == OS_STACK_PATTERN)) {
+        word++;
+    }
+    return (uint32)((end - word) * sizeof(tpl_stack_word));
+}
+
+/*
+ * The peak usages are written in TPL_STACK_REPORT_FILE as an OIL
+ * fragment that sets the MEASURED_STACK of the tasks and ISR2. The file
+ * is rewritten at each dump. Once included in the CPU of the OIL file,
+ * goil recommends a STACKSIZE for each of them in stack_sizes.txt.
+ */
+FUNC(void, OS_CODE) tpl_dump_stack_usage(void)
+{
+    FILE *file = fopen(TPL_STACK_REPORT_FILE, "w");
+    const struct TPL_STACK *stack;
+    tpl_proc_id proc_id;
+
+    if (file == NULL) {
+        perror("tpl_dump_stack_usage: " TPL_STACK_REPORT_FILE);
+        return;
+    }
+    stack = tpl_stat_proc_table[TASK_COUNT + ISR_COUNT]->stack;
+    fprintf(file, "/*\n * trampoline peak stack usage, bytes\n"
+                  " * idle task: %lu of %lu\n */\n",
+            (unsigned long)tpl_stack_usage(stack),
+            (unsigned long)stack->stack_size);
+    for (proc_id = 0; proc_id < TASK_COUNT + ISR_COUNT; proc_id++) {
+        stack = tpl_stat_proc_table[proc_id]->stack;
+        fprintf(file, "%s %s { MEASURED_STACK = %lu; }; /* of %lu",
+                (proc_id < TASK_COUNT) ? "TASK" : "ISR",
+                proc_name_table[proc_id],
+                (unsigned long)tpl_stack_usage(stack),
+                (unsigned long)stack->stack_size);
+#if WITH_SHARED_STACKS == YES
+        if (tpl_stack_owner(proc_id) != proc_id) {
+            fprintf(file, ", shared with %s",
+                    proc_name_table[tpl_stack_owner(proc_id)]);
+        }
+#endif
+        fprintf(file, " */\n");
+    }
+    fclose(file);
+}
+#endif /* WITH_STACK_REPORT */
+
 /*
  * tpl_init_machine starts the virtual processor hosted in
  * a Unix process
@@ -200,6 +372,25 @@ void tpl_init_machine(void)
             proc_id < TASK_COUNT+ISR_COUNT+1;
             proc_id++)
     {
+#if WITH_SHARED_STACKS == YES
+        /*
+         * A context starts with the first dispatch of its process on the
+         * top of its stack. The processes that share a stack are never
+         * started together and use the initial context of the first one.
+         */
+        const tpl_proc_id owner = tpl_stack_owner(proc_id);
+
+        if (owner != proc_id) {
+            memcpy(tpl_stat_proc_table[proc_id]->context->initial,
+                   tpl_stat_proc_table[owner]->context->initial,
+                   sizeof(jmp_buf));
+            continue;
+        }
+#endif
+#if (WITH_PAINT_STACK == YES) || (WITH_STACK_REPORT == YES) || \
+    (WITH_STACK_MONITORING == YES)
+        tpl_paint_stack(tpl_stat_proc_table[proc_id]->stack);
+#endif
         tpl_create_context(proc_id);
     }
 
@@ -210,6 +401,10 @@ void tpl_init_machine(void)
 
     tpl_viper_init();
 
+#if WITH_POSIX_VIRTUAL_TIME == YES
+    tpl_viper_start_virtual_time();
+#endif
+
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     tpl_viper_start_auto_timer(signal_for_counters,10000);  /* 10 ms */
 #endif
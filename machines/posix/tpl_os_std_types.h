@@ -69,6 +69,21 @@ typedef unsigned long   uint32;
  */
 typedef signed long     sint32;
 
+/**
+ * @typedef uint64
+ *
+ * 64 bits unsigned number
+ */
+typedef unsigned long long uint64;
+
+/**
+ * @def TPL_TIME_64BIT
+ *
+ * The timing protection counts nanoseconds on the posix target, so
+ * tpl_time is on 64 bits.
+ */
+#define TPL_TIME_64BIT
+
 #endif /* TPL_OS_STD_TYPES_H */
 
 /* End of file tpl_os_std_types.h */
@@ -27,6 +27,10 @@
  */
 #include <sys/time.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
 
 #include "tpl_os_types.h"
 #include "tpl_machine_interface.h"
@@ -35,70 +39,172 @@
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 
 #include "tpl_as_timing_protec.h"
-
-/* Timer used for timing protection
- * TODO use system timer provided by viper?
+#include "tpl_os_kernel.h"
+#include "tpl_os_interrupt_kernel.h"
+#include "tpl_posix_internal.h"
+
+/*
+ * The timing protection uses the POSIX timers on CLOCK_MONOTONIC. Each
+ * core has one timer per watchdog kind. A timer sends
+ * TPL_WATCHDOG_SIGNAL with core * NB_WATCHDOGS_PER_PROC + kind as value.
+ * The dates are counted in nanoseconds and tpl_time is in
+ * TPL_TP_TIME_UNIT_NS nanoseconds (TIMING_PROTECTION_UNIT in the OIL).
  */
-static struct timeval startup_time;
+static struct timespec startup_time;
+static timer_t tpl_tp_timer[NUMBER_OF_CORES][NB_WATCHDOGS_PER_PROC];
+/* TRUE from the start of a watchdog to its cancel or expiration */
+static volatile tpl_bool tpl_tp_armed[NUMBER_OF_CORES][NB_WATCHDOGS_PER_PROC];
+
+#if NUMBER_OF_CORES > 1
+#define TP_CORE(core_id) core_id
+#else
+#define TP_CORE(core_id) 0
+#endif
 
 void tpl_start_tptimer ()
 {
-    gettimeofday (&startup_time, NULL);  
+    struct sigevent event;
+    unsigned int core, kind;
+
+    clock_gettime(CLOCK_MONOTONIC, &startup_time);
+
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = TPL_WATCHDOG_SIGNAL;
+    for (core = 0; core < NUMBER_OF_CORES; core++) {
+        for (kind = 0; kind < NB_WATCHDOGS_PER_PROC; kind++) {
+            event.sigev_value.sival_int = (int)(core * NB_WATCHDOGS_PER_PROC + kind);
+            tpl_tp_armed[core][kind] = FALSE;
+            if (timer_create(CLOCK_MONOTONIC, &event, &tpl_tp_timer[core][kind]) != 0) {
+                perror("tpl_start_tptimer: timer_create");
+                exit(-1);
+            }
+        }
+    }
 }
 
-/* Time in tenth of milliseconds since system startup */
-FUNC(tpl_time, OS_CODE) tpl_get_tptimer (void)
+/* Time in nanoseconds since system startup */
+static uint64 tpl_tp_now(void)
 {
-    struct timeval time;
-    tpl_time result;
+    struct timespec now;
 
-    gettimeofday (&time, NULL);
-    result = 
-        (time.tv_sec - startup_time.tv_sec) * 100
-        + (time.tv_usec - startup_time.tv_usec) / 10000;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64)(now.tv_sec - startup_time.tv_sec) * 1000000000ULL
+           + (uint64)now.tv_nsec - (uint64)startup_time.tv_nsec;
+}
 
-    return result;
+/* Time in TPL_TP_TIME_UNIT_NS since system startup */
+FUNC(tpl_time, OS_CODE) tpl_get_tptimer (void)
+{
+    return (tpl_time)(tpl_tp_now() / TPL_TP_TIME_UNIT_NS);
 }
 
-/* Sets a watchdog to expire in tenth of millisec */
-FUNC(void, OS_CODE) tpl_set_tpwatchdog (
+/* Sets the watchdog kind of the current core to expire in delay */
+FUNC(void, OS_CODE) tpl_set_tpwatchdog_kind (
+        CONST(uint8, AUTOMATIC) kind,
         CONST(tpl_time, AUTOMATIC) delay)
 {
-    struct itimerval watchdog;
-    tpl_time offset;
-
-    offset = delay;
+    GET_CURRENT_CORE_ID(core_id)
+    struct itimerspec watchdog;
+    const uint64 offset = (uint64)delay * TPL_TP_TIME_UNIT_NS;
 
-    /* configure and start the watchdog */
+    /* a zero it_value would disarm the timer */
     watchdog.it_interval.tv_sec = 0;
-    watchdog.it_interval.tv_usec = 0;
-    watchdog.it_value.tv_sec = offset / 100;
-    watchdog.it_value.tv_usec = (offset % 100)  * 10000;
-    setitimer (ITIMER_REAL, &watchdog, NULL);
+    watchdog.it_interval.tv_nsec = 0;
+    watchdog.it_value.tv_sec = (time_t)(offset / 1000000000ULL);
+    watchdog.it_value.tv_nsec = offset == 0 ? 1 : (long)(offset % 1000000000ULL);
+    tpl_tp_armed[TP_CORE(core_id)][kind] = TRUE;
+    timer_settime(tpl_tp_timer[TP_CORE(core_id)][kind], 0, &watchdog, NULL);
 }
 
-FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void)
+FUNC(void, OS_CODE) tpl_cancel_tpwatchdog_kind(
+        CONST(uint8, AUTOMATIC) kind)
 {
-    struct itimerval watchdog;
+    GET_CURRENT_CORE_ID(core_id)
+    struct itimerspec watchdog;
 
-    watchdog.it_interval.tv_sec = 0;
-    watchdog.it_interval.tv_usec = 0;
-    watchdog.it_value.tv_sec = 0;
-    watchdog.it_value.tv_usec = 0;
-    setitimer (ITIMER_REAL, &watchdog, NULL);
+    memset(&watchdog, 0, sizeof(watchdog));
+    tpl_tp_armed[TP_CORE(core_id)][kind] = FALSE;
+    timer_settime(tpl_tp_timer[TP_CORE(core_id)][kind], 0, &watchdog, NULL);
+}
+
+/*
+ * The signal handler of the watchdogs. A signal may still be pending
+ * when its watchdog is canceled or started again, so it is taken only if
+ * the watchdog is armed and its timer is over.
+ */
+void tpl_watchdog_signal_handler(int sig, siginfo_t *info, void *context)
+{
+    const unsigned int id = (unsigned int)info->si_value.sival_int;
+    const unsigned int core = id / NB_WATCHDOGS_PER_PROC;
+    const unsigned int kind = id % NB_WATCHDOGS_PER_PROC;
+    struct itimerspec left;
+
+    (void)sig;
+    (void)context;
+
+    tpl_locking_depth++;
+    tpl_cpt_os_task_lock++;
+
+    if ((SI_TIMER == info->si_code) &&
+        (core < NUMBER_OF_CORES) &&
+        (tpl_tp_armed[core][kind] == TRUE) &&
+        (timer_gettime(tpl_tp_timer[core][kind], &left) == 0) &&
+        (left.it_value.tv_sec == 0) && (left.it_value.tv_nsec == 0))
+    {
+        tpl_tp_armed[core][kind] = FALSE;
+        /* This function is defined in autosar/tpl_as_timing_protec.c */
+        tpl_watchdog_kind_expiration((uint8)kind);
+    }
+
+    tpl_locking_depth--;
+    tpl_cpt_os_task_lock--;
 }
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
-#if WITH_AUTOSAR_STACK_MONITORING == YES
-    FUNC(tpl_bool, OS_CODE) tpl_check_stack_pointer(
-            CONST(tpl_proc_id, AUTOMATIC) proc_id)
+#if WITH_STACK_MONITORING == YES
+
+#include "tpl_os_kernel.h"
+
+/*
+ * The kernel runs on the stack of the running process, so the stack
+ * pointer is only known for it. Below the zone and within
+ * TPL_STACK_OVERFLOW_AREA bytes, it has undoubtedly overflowed.
+ */
+#define TPL_STACK_OVERFLOW_AREA 65536
+
+FUNC(tpl_bool, OS_CODE) tpl_check_stack_pointer(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
-    return 1;
+    GET_CURRENT_CORE_ID(core_id)
+    GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+    volatile tpl_stack_word here;
+    const char *sp = (const char *)&here;
+    const char *bottom;
+
+    if ((proc_id != TPL_KERN_REF(kern).running_id) ||
+        ((uint32)proc_id >= (TASK_COUNT + ISR_COUNT + 1)))
+    {
+        return 1;
+    }
+    bottom = (const char *)tpl_stat_proc_table[proc_id]->stack->stack_zone;
+
+    return !((sp < bottom) && (sp >= bottom - TPL_STACK_OVERFLOW_AREA));
 }
 
-    FUNC(tpl_bool, OS_CODE) tpl_check_stack_footprint(
-            CONST(tpl_proc_id, AUTOMATIC) proc_id)
+/*
+ * The stacks are painted by tpl_init_machine and grow down, the bottom
+ * word of a zone is overwritten when the whole zone has been used.
+ */
+FUNC(uint8, OS_CODE) tpl_check_stack_footprint(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
-    return 1;
+    if ((uint32)proc_id >= (TASK_COUNT + ISR_COUNT + 1))
+    {
+        return 1;
+    }
+
+    return tpl_stat_proc_table[proc_id]->stack->stack_zone[0] ==
+           OS_STACK_PATTERN;
 }
-#endif /* WITH_AUTOSAR_STACK_MONITORING */
+#endif /* WITH_STACK_MONITORING */
@@ -25,7 +25,9 @@
  * $URL$
  */
 
+#ifndef _XOPEN_SOURCE
 #define _XOPEN_SOURCE 501
+#endif
 #include <setjmp.h>
 #include <signal.h>
 #include <stdlib.h>
@@ -25,6 +25,8 @@
  * $URL$
  */
 
+#include <signal.h>
+
 #include "tpl_app_config.h"
 #include "tpl_app_custom_types.h"
 
@@ -34,7 +36,11 @@ extern const int signal_for_counters;
 #endif
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
+/* The watchdogs of the timing protection send the last real time signal */
+#define TPL_WATCHDOG_SIGNAL (SIGRTMAX)
+
 void tpl_start_tptimer ();
+void tpl_watchdog_signal_handler(int sig, siginfo_t *info, void *context);
 #endif
 
 void tpl_create_context(tpl_proc_id proc_id);
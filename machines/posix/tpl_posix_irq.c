@@ -35,9 +35,20 @@
 #include "tpl_app_config.h"
 #include "tpl_os_interrupt_kernel.h"
 #include "tpl_machine_posix.h"
+#include "tpl_viper_interface.h"
+#include "viper.h"
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 #include "tpl_as_timing_protec.h"
+#include "tpl_posix_internal.h"
+#endif
+
+#if WITH_TRACE == YES
+#include "tpl_trace.h"
+#endif
+
+#if WITH_EXTERNAL_COM == YES
+#include "tpl_posix_shm_bus.h"
 #endif
 
 /*
@@ -47,16 +58,17 @@
 #if ISR_COUNT > 0
 extern int signal_for_isr_id[ISR_COUNT];
 #endif
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
-const int signal_for_watchdog = SIGALRM;
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
 const int signal_for_counters = SIGUSR2;
 #endif
-
-extern volatile int tpl_locking_depth;
-extern char tpl_user_task_lock;
-extern char tpl_cpt_os_task_lock;
+#if WITH_POSIX_RT_IRQ == YES
+/*
+ * Direct lookup tables of the interrupt lines carried by the payload
+ * of real time signals. They are generated by goil.
+ */
+extern const int tpl_isr_for_irq_line[TPL_IRQ_LINE_COUNT];
+extern const int tpl_rt_signals[TPL_RT_SIGNAL_COUNT];
+#endif /* WITH_POSIX_RT_IRQ */
 
 /*
  * The signal set corresponding to enabled interrupts
@@ -69,6 +81,34 @@ sigset_t signal_set;
  */
 extern void tpl_call_counter_tick();
 
+#if (WITH_TRACE == YES) && \
+    (((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0))
+/*
+ * Applies the trace control the host wrote through viper. It is read at
+ * each tick of the counters, so it is only built when there are counters.
+ */
+static void tpl_posix_trace_control(void)
+{
+    static unsigned int seq = 0;
+    vp_trace_ctrl host;
+    tpl_trace_control control;
+    unsigned int word;
+
+    if (tpl_viper_get_trace_control(&seq, &host))
+    {
+        control.classes = host.classes;
+        control.sampling = host.sampling;
+        control.countdown = 0;
+        for (word = 0; word < TPL_TRACE_PROC_WORDS; word++)
+        {
+            control.masked_procs[word] =
+              (word < VP_TRACE_PROC_WORDS) ? host.masked_procs[word] : 0;
+        }
+        tpl_trace_set_control(&control);
+    }
+}
+#endif
+
 
 /**
  * Enable all interrupts
@@ -129,20 +169,14 @@ void tpl_signal_handler(int sig)
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     if (signal_for_counters == sig)
     {
+#if WITH_TRACE == YES
+        tpl_posix_trace_control();
+#endif
         tpl_call_counter_tick();
     }
     else
     {
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
-        if (signal_for_watchdog == sig)
-        {
-            /* This function is defined in autosar/tpl_as_timing_protec.c */
-            tpl_watchdog_expiration();
-        }
-        else
-        {
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 #if ISR_COUNT > 0
             id = 0;
             found = (sig == signal_for_isr_id[id]);
@@ -167,9 +201,6 @@ void tpl_signal_handler(int sig)
                 tpl_shutdown();
             }
 #endif /* ISR_COUNT > 0 */
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
-        }
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     }
 #endif /* (defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
@@ -179,6 +210,55 @@ void tpl_signal_handler(int sig)
 
 }
 
+#if WITH_POSIX_RT_IRQ == YES
+/*
+ * Payload of the interrupt line being handled. It is saved and restored
+ * around the ISR so a nested line does not change it.
+ */
+static volatile unsigned int tpl_irq_payload = 0;
+
+unsigned int tpl_viper_irq_payload(void)
+{
+    return tpl_irq_payload;
+}
+
+/*
+ * The signal handler of the real time signals. The ISR is found in
+ * one access from the interrupt line sent with sigqueue.
+ */
+void tpl_rt_signal_handler(int sig, siginfo_t *info, void *context)
+{
+    const unsigned int value = (unsigned int)info->si_value.sival_int;
+    const unsigned int line = value & VP_LINE_MASK;
+    const unsigned int interrupted_payload = tpl_irq_payload;
+
+    (void)context;
+
+    tpl_locking_depth++;
+    tpl_cpt_os_task_lock++;
+
+    if ((SI_QUEUE == info->si_code) &&
+        (line < TPL_IRQ_LINE_COUNT) &&
+        (tpl_isr_for_irq_line[line] >= 0))
+    {
+        tpl_irq_payload = value >> VP_PAYLOAD_SHIFT;
+        tpl_central_interrupt_handler(tpl_isr_for_irq_line[line] + TASK_COUNT);
+        tpl_irq_payload = interrupted_payload;
+    }
+    else
+    {
+        /* Unknown interrupt request ! */
+        printf("No ISR is registered for line %u of signal SIGRTMIN+%d\n",
+               line, sig - SIGRTMIN);
+        printf("Cowardly exiting!\n");
+        tpl_shutdown();
+    }
+
+    tpl_locking_depth--;
+    tpl_cpt_os_task_lock--;
+}
+#endif /* WITH_POSIX_RT_IRQ */
+
 /* Posix platform internal functions */
 void tpl_posix_sigblock(const char* error_message)
 {
@@ -202,7 +282,7 @@ void tpl_posix_siginit(void)
 {
 
     struct sigaction sa;
-#if ISR_COUNT > 0
+#if (ISR_COUNT > 0) || (WITH_POSIX_RT_IRQ == YES) || (WITH_EXTERNAL_COM == YES)
     int id;
 #endif
 
@@ -213,12 +293,25 @@ void tpl_posix_siginit(void)
      */
 #if ISR_COUNT > 0
     for (id = 0; id < ISR_COUNT; id++) {
-        sigaddset(&signal_set,signal_for_isr_id[id]);
+        /* the ISRs on an interrupt line have no classic signal */
+        if (signal_for_isr_id[id] != 0) {
+            sigaddset(&signal_set,signal_for_isr_id[id]);
+        }
     }
 #endif
+#if WITH_POSIX_RT_IRQ == YES
+    for (id = 0; id < TPL_RT_SIGNAL_COUNT; id++) {
+        sigaddset(&signal_set,SIGRTMIN + tpl_rt_signals[id]);
+    }
+#endif /* WITH_POSIX_RT_IRQ */
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
-    sigaddset(&signal_set,signal_for_watchdog);
+    sigaddset(&signal_set,TPL_WATCHDOG_SIGNAL);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+#if WITH_EXTERNAL_COM == YES
+    for (id = 0; id < TPL_SHM_BUS_SIGNAL_COUNT; id++) {
+        sigaddset(&signal_set,SIGRTMIN + tpl_shm_bus_signals[id]);
+    }
+#endif /* WITH_EXTERNAL_COM */
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     sigaddset(&signal_set,signal_for_counters);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
@@ -234,14 +327,43 @@ void tpl_posix_siginit(void)
      */
 #if ISR_COUNT > 0
     for (id = 0; id < ISR_COUNT; id++) {
-        sigaction(signal_for_isr_id[id],&sa,NULL);
+        if (signal_for_isr_id[id] != 0) {
+            sigaction(signal_for_isr_id[id],&sa,NULL);
+        }
     }
 #endif
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
-    sigaction(signal_for_watchdog,&sa,NULL);
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 #if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
     sigaction(signal_for_counters,&sa,NULL);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
+#if WITH_POSIX_RT_IRQ == YES
+    /*
+     * The real time signals get the interrupt line with the siginfo
+     */
+    sa.sa_sigaction = tpl_rt_signal_handler;
+    sa.sa_flags = SA_RESTART | SA_SIGINFO;
+    for (id = 0; id < TPL_RT_SIGNAL_COUNT; id++) {
+        sigaction(SIGRTMIN + tpl_rt_signals[id],&sa,NULL);
+    }
+#endif /* WITH_POSIX_RT_IRQ */
+#if WITH_AUTOSAR_TIMING_PROTECTION == YES
+    /*
+     * The watchdogs are real time signals so that two expirations are
+     * not merged. The siginfo gives the core and the kind.
+     */
+    sa.sa_sigaction = tpl_watchdog_signal_handler;
+    sa.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigaction(TPL_WATCHDOG_SIGNAL,&sa,NULL);
+#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+#if WITH_EXTERNAL_COM == YES
+    /*
+     * The real time signals of the shared memory buses wake the node up
+     * when frames are written in the ring of a bus
+     */
+    sa.sa_sigaction = tpl_shm_bus_signal_handler;
+    sa.sa_flags = SA_RESTART | SA_SIGINFO;
+    for (id = 0; id < TPL_SHM_BUS_SIGNAL_COUNT; id++) {
+        sigaction(SIGRTMIN + tpl_shm_bus_signals[id],&sa,NULL);
+    }
+#endif /* WITH_EXTERNAL_COM */
 }
 
@@ -0,0 +1,439 @@
+/**
+ *
+ * @file tpl_posix_shm_bus.c
+ *
+ * @section descr File description
+ *
+ * Shared memory bus driver of the external COM on the posix platform.
+ *
+ * A bus is a shared memory object /tpl_bus.<name> mapped by the ECUs of
+ * the bus. It holds a ring of frames written by all the nodes under a
+ * process shared mutex. A batch of frames is written at once and each
+ * other node is sent one real time signal, only if the previous one was
+ * handled, so that a node handles all the frames written since its last
+ * wake up in one signal handler.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "tpl_app_config.h"
+#include "tpl_os_interrupt_kernel.h"
+#include "tpl_posix_internal.h"
+#include "tpl_posix_shm_bus.h"
+
+#if WITH_EXTERNAL_COM == YES
+
+#include "tpl_com_external_com.h"
+
+#define TPL_SHM_BUS_MAGIC       0x54504C42u
+#define TPL_SHM_BUS_NAME_SIZE   64
+/* time given to the node that creates a bus to initialize it, in ms */
+#define TPL_SHM_BUS_INIT_WAIT   1000
+
+extern sigset_t signal_set;
+
+typedef struct {
+    unsigned int id;
+    unsigned char size;
+    unsigned char node;
+    unsigned long long date;
+    unsigned char data[TPL_IPDU_MAX_SIZE];
+} tpl_shm_frame;
+
+/*
+ * The shared memory object of a bus
+ * - magic is written last by the node that creates the bus
+ * - size is the size of the object, it checks the layout is the same
+ * - write_seq is the number of frames written since the creation
+ * - pid is the process of each node, 0 when the node is not started
+ * - notified is set by a sender when it signals a node and cleared by
+ *   the node when it reads the ring
+ */
+struct TPL_SHM_BUS_SEGMENT {
+    volatile unsigned int magic;
+    unsigned int size;
+    pthread_mutex_t lock;
+    unsigned long long write_seq;
+    pid_t pid[TPL_SHM_BUS_NODES];
+    unsigned char notified[TPL_SHM_BUS_NODES];
+    tpl_shm_frame ring[TPL_SHM_BUS_SLOTS];
+};
+
+typedef struct TPL_SHM_BUS_SEGMENT tpl_shm_bus_segment;
+
+static unsigned long long tpl_shm_bus_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL +
+           (unsigned long long)now.tv_nsec;
+}
+
+static void tpl_shm_bus_path(const tpl_shm_bus_config *config, char *path)
+{
+    snprintf(path, TPL_SHM_BUS_NAME_SIZE, "/tpl_bus.%s", config->name);
+}
+
+/*
+ * Locks the ring of a bus. A node that died with the lock leaves the
+ * ring consistent since a frame is only counted once written.
+ */
+static void tpl_shm_bus_lock(tpl_shm_bus_segment *segment)
+{
+    if (pthread_mutex_lock(&segment->lock) == EOWNERDEAD)
+    {
+        pthread_mutex_consistent(&segment->lock);
+    }
+}
+
+static void tpl_shm_bus_unlock(tpl_shm_bus_segment *segment)
+{
+    pthread_mutex_unlock(&segment->lock);
+}
+
+/*
+ * Creates the shared memory object of a bus or maps the one created by
+ * another node.
+ */
+static tpl_shm_bus_segment *tpl_shm_bus_map(const tpl_shm_bus_config *config)
+{
+    char path[TPL_SHM_BUS_NAME_SIZE];
+    tpl_shm_bus_segment *segment;
+    pthread_mutexattr_t attr;
+    struct stat st;
+    struct timespec wait = { 0, 1000000 };
+    int created = 1;
+    int waited = 0;
+    int fd;
+
+    tpl_shm_bus_path(config, path);
+    fd = shm_open(path, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 && errno == EEXIST)
+    {
+        created = 0;
+        fd = shm_open(path, O_RDWR, 0600);
+    }
+    if (fd < 0)
+    {
+        perror("tpl_shm_bus: unable to open the shared memory object");
+        exit(-1);
+    }
+
+    if (created)
+    {
+        if (ftruncate(fd, sizeof(tpl_shm_bus_segment)) != 0)
+        {
+            perror("tpl_shm_bus: unable to size the shared memory object");
+            exit(-1);
+        }
+    }
+    else
+    {
+        /* the creator may not have sized the object yet */
+        while ((fstat(fd, &st) == 0) && (st.st_size == 0) &&
+               (waited++ < TPL_SHM_BUS_INIT_WAIT))
+        {
+            nanosleep(&wait, NULL);
+        }
+    }
+
+    segment = mmap(0, sizeof(tpl_shm_bus_segment), PROT_READ | PROT_WRITE,
+                   MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED)
+    {
+        perror("tpl_shm_bus: unable to map the shared memory object");
+        exit(-1);
+    }
+
+    if (created)
+    {
+        memset(segment, 0, sizeof(tpl_shm_bus_segment));
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&segment->lock, &attr);
+        pthread_mutexattr_destroy(&attr);
+        segment->size = sizeof(tpl_shm_bus_segment);
+        __sync_synchronize();
+        segment->magic = TPL_SHM_BUS_MAGIC;
+    }
+    else
+    {
+        waited = 0;
+        while ((segment->magic != TPL_SHM_BUS_MAGIC) &&
+               (waited++ < TPL_SHM_BUS_INIT_WAIT))
+        {
+            nanosleep(&wait, NULL);
+        }
+        if ((segment->magic != TPL_SHM_BUS_MAGIC) ||
+            (segment->size != sizeof(tpl_shm_bus_segment)))
+        {
+            fprintf(stderr, "tpl_shm_bus: %s is not a bus of this version, "
+                    "remove /dev/shm%s\n", path, path);
+            exit(-1);
+        }
+    }
+    return segment;
+}
+
+void tpl_shm_bus_init(const tpl_com_bus *bus)
+{
+    const tpl_shm_bus_config *config = bus->config;
+    tpl_shm_bus_state *state = config->state;
+    tpl_shm_bus_segment *segment = tpl_shm_bus_map(config);
+    pid_t owner;
+
+    tpl_shm_bus_lock(segment);
+    owner = segment->pid[config->node];
+    if ((owner != 0) && (owner != getpid()) && (kill(owner, 0) == 0))
+    {
+        tpl_shm_bus_unlock(segment);
+        fprintf(stderr, "tpl_shm_bus: node %u of bus %s is used by "
+                "process %d\n", config->node, config->name, (int)owner);
+        exit(-1);
+    }
+    segment->pid[config->node] = getpid();
+    segment->notified[config->node] = 0;
+    /* the frames written before the start are not received */
+    state->segment = segment;
+    state->read_seq = segment->write_seq;
+    memset(&state->stats, 0, sizeof(tpl_shm_bus_stats));
+    tpl_shm_bus_unlock(segment);
+}
+
+void tpl_shm_bus_send(const tpl_com_bus *bus,
+                      const tpl_com_frame *frames,
+                      uint32 count)
+{
+    const tpl_shm_bus_config *config = bus->config;
+    tpl_shm_bus_state *state = config->state;
+    tpl_shm_bus_segment *segment = state->segment;
+    const unsigned long long date = tpl_shm_bus_now();
+    pid_t wake[TPL_SHM_BUS_NODES];
+    union sigval value;
+    unsigned int node;
+    uint32 i;
+
+    tpl_shm_bus_lock(segment);
+    for (i = 0; i < count; i++)
+    {
+        tpl_shm_frame *slot =
+            &segment->ring[segment->write_seq % TPL_SHM_BUS_SLOTS];
+
+        slot->id = frames[i].id;
+        slot->size = frames[i].size;
+        slot->node = (unsigned char)config->node;
+        slot->date = date;
+        memcpy(slot->data, frames[i].data, frames[i].size);
+        segment->write_seq++;
+    }
+    /* one signal per node, unless the node has not handled the last one */
+    for (node = 0; node < TPL_SHM_BUS_NODES; node++)
+    {
+        wake[node] = 0;
+        if ((node != config->node) && (segment->pid[node] != 0) &&
+            !segment->notified[node])
+        {
+            segment->notified[node] = 1;
+            wake[node] = segment->pid[node];
+        }
+    }
+    tpl_shm_bus_unlock(segment);
+
+    value.sival_int = 0;
+    for (node = 0; node < TPL_SHM_BUS_NODES; node++)
+    {
+        if ((wake[node] != 0) &&
+            (sigqueue(wake[node], SIGRTMIN + config->signal, value) != 0) &&
+            (errno == ESRCH))
+        {
+            /* the node is gone */
+            tpl_shm_bus_lock(segment);
+            if (segment->pid[node] == wake[node])
+            {
+                segment->pid[node] = 0;
+            }
+            tpl_shm_bus_unlock(segment);
+        }
+    }
+
+    state->stats.frames_sent += count;
+    state->stats.batches_sent++;
+}
+
+/*
+ * Reads the frames written in the ring of a bus since the last read and
+ * gives them to the COM. Returns the number of frames received.
+ */
+static unsigned int tpl_shm_bus_read(const tpl_com_bus *bus)
+{
+    const tpl_shm_bus_config *config = bus->config;
+    tpl_shm_bus_state *state = config->state;
+    tpl_shm_bus_segment *segment = state->segment;
+    unsigned int received = 0;
+    unsigned long long latency;
+    tpl_com_frame frame;
+
+    tpl_shm_bus_lock(segment);
+    segment->notified[config->node] = 0;
+    if (segment->write_seq - state->read_seq > TPL_SHM_BUS_SLOTS)
+    {
+        /* the oldest frames have been overwritten */
+        state->stats.frames_lost +=
+            segment->write_seq - state->read_seq - TPL_SHM_BUS_SLOTS;
+        state->read_seq = segment->write_seq - TPL_SHM_BUS_SLOTS;
+    }
+    while (state->read_seq != segment->write_seq)
+    {
+        const tpl_shm_frame *slot =
+            &segment->ring[state->read_seq % TPL_SHM_BUS_SLOTS];
+
+        state->read_seq++;
+        if (slot->node != config->node)
+        {
+            frame.id = slot->id;
+            frame.size = slot->size;
+            frame.data = slot->data;
+            tpl_com_receive_frame(bus, &frame);
+
+            latency = tpl_shm_bus_now() - slot->date;
+            if ((state->stats.frames_received == 0) ||
+                (latency < state->stats.latency_min))
+            {
+                state->stats.latency_min = latency;
+            }
+            if (latency > state->stats.latency_max)
+            {
+                state->stats.latency_max = latency;
+            }
+            state->stats.latency_sum += latency;
+            state->stats.frames_received++;
+            received++;
+        }
+    }
+    tpl_shm_bus_unlock(segment);
+
+    return received;
+}
+
+void tpl_shm_bus_signal_handler(int sig, siginfo_t *info, void *context)
+{
+    unsigned int received = 0;
+    unsigned int id;
+
+    (void)info;
+    (void)context;
+
+    tpl_locking_depth++;
+    tpl_cpt_os_task_lock++;
+
+    for (id = 0; id < COM_BUS_COUNT; id++)
+    {
+        const tpl_shm_bus_config *config = tpl_com_bus_table[id]->config;
+
+        /* a frame may be sent to the node before it starts the bus */
+        if ((SIGRTMIN + config->signal == sig) &&
+            (config->state->segment != NULL))
+        {
+            config->state->stats.wakeups++;
+            received += tpl_shm_bus_read(tpl_com_bus_table[id]);
+        }
+    }
+    if (received > 0)
+    {
+        tpl_com_end_of_reception();
+    }
+
+    tpl_locking_depth--;
+    tpl_cpt_os_task_lock--;
+}
+
+void tpl_shm_bus_shutdown(void)
+{
+    char path[TPL_SHM_BUS_NAME_SIZE];
+    unsigned int id;
+    unsigned int node;
+    int used;
+
+    for (id = 0; id < COM_BUS_COUNT; id++)
+    {
+        const tpl_shm_bus_config *config = tpl_com_bus_table[id]->config;
+        tpl_shm_bus_segment *segment = config->state->segment;
+
+        if (segment != NULL)
+        {
+            used = 0;
+            tpl_shm_bus_lock(segment);
+            segment->pid[config->node] = 0;
+            for (node = 0; node < TPL_SHM_BUS_NODES; node++)
+            {
+                used |= (segment->pid[node] != 0);
+            }
+            tpl_shm_bus_unlock(segment);
+            if (!used)
+            {
+                tpl_shm_bus_path(config, path);
+                shm_unlink(path);
+            }
+            munmap(segment, sizeof(tpl_shm_bus_segment));
+            config->state->segment = NULL;
+        }
+    }
+}
+
+int tpl_shm_bus_get_stats(const char *name, tpl_shm_bus_stats *stats)
+{
+    sigset_t interrupted;
+    unsigned int id;
+    int found = 0;
+
+    for (id = 0; (id < COM_BUS_COUNT) && !found; id++)
+    {
+        const tpl_shm_bus_config *config = tpl_com_bus_table[id]->config;
+
+        if (strcmp(config->name, name) == 0)
+        {
+            /* the signal handlers update the statistics */
+            sigprocmask(SIG_BLOCK, &signal_set, &interrupted);
+            *stats = config->state->stats;
+            sigprocmask(SIG_SETMASK, &interrupted, NULL);
+            found = 1;
+        }
+    }
+    return found;
+}
+
+#endif /* WITH_EXTERNAL_COM */
+
+/* End of file tpl_posix_shm_bus.c */
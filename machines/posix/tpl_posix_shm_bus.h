@@ -0,0 +1,120 @@
+/**
+ *
+ * @file tpl_posix_shm_bus.h
+ *
+ * @section descr File description
+ *
+ * Shared memory bus driver of the external COM on the posix platform.
+ * The ECUs of a bus are Trampoline processes of the same host. They
+ * exchange the I-PDUs through a ring of frames in a POSIX shared memory
+ * object and wake the receivers up with a real time signal.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_POSIX_SHM_BUS_H
+#define TPL_POSIX_SHM_BUS_H
+
+#include <signal.h>
+
+#include "tpl_app_config.h"
+
+/*
+ * Nodes (ECUs) of a bus and frames of the ring of a bus
+ */
+#define TPL_SHM_BUS_NODES   16
+#define TPL_SHM_BUS_SLOTS   256
+
+/*
+ * Statistics of a bus in an ECU. The latencies are the time between the
+ * write of a frame in the ring and its reception by the COM, in ns.
+ */
+typedef struct {
+    unsigned long long frames_sent;
+    unsigned long long batches_sent;
+    unsigned long long frames_received;
+    unsigned long long frames_lost;
+    unsigned long long wakeups;
+    unsigned long long latency_min;
+    unsigned long long latency_max;
+    unsigned long long latency_sum;
+} tpl_shm_bus_stats;
+
+struct TPL_SHM_BUS_SEGMENT;
+
+/*
+ * State of a bus in an ECU: the mapped segment, the sequence number of
+ * the next frame to read and the statistics.
+ */
+typedef struct {
+    struct TPL_SHM_BUS_SEGMENT *segment;
+    unsigned long long read_seq;
+    tpl_shm_bus_stats stats;
+} tpl_shm_bus_state;
+
+/*
+ * Configuration of a bus, generated by goil from the BUS object
+ * - name: the name of the BUS object, the shared memory object is
+ *   /tpl_bus.<name>
+ * - node: the node of the ECU on the bus
+ * - signal: the real time signal SIGRTMIN + signal wakes the node up
+ */
+typedef struct {
+    const char *name;
+    unsigned int node;
+    int signal;
+    tpl_shm_bus_state *state;
+} tpl_shm_bus_config;
+
+#if WITH_EXTERNAL_COM == YES
+#include "tpl_com_ipdu.h"
+
+/*
+ * Bus driver functions of the tpl_com_bus descriptors
+ */
+void tpl_shm_bus_init(const tpl_com_bus *bus);
+void tpl_shm_bus_send(const tpl_com_bus *bus,
+                      const tpl_com_frame *frames,
+                      uint32 count);
+
+/*
+ * Handler of the real time signals of the buses
+ */
+void tpl_shm_bus_signal_handler(int sig, siginfo_t *info, void *context);
+
+/*
+ * Leaves the buses, called by tpl_shutdown. The shared memory object is
+ * removed by the last node.
+ */
+void tpl_shm_bus_shutdown(void);
+
+/*
+ * Copies the statistics of the bus named name. Returns 0 when the bus
+ * does not exist.
+ */
+int tpl_shm_bus_get_stats(const char *name, tpl_shm_bus_stats *stats);
+
+/*
+ * Real time signals (offset from SIGRTMIN) of the buses
+ */
+extern const int tpl_shm_bus_signals[TPL_SHM_BUS_SIGNAL_COUNT];
+
+#endif /* WITH_EXTERNAL_COM */
+
+#endif /* TPL_POSIX_SHM_BUS_H */
+
+/* End of file tpl_posix_shm_bus.h */
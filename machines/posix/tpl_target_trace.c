@@ -26,6 +26,8 @@
  */
 #include "tpl_target_trace.h"
 
+#if WITH_TRACE == YES
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -178,3 +180,5 @@ FUNC(void, OS_CODE)tpl_trace_format_bin(void)
 
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
+
+#endif /* WITH_TRACE */
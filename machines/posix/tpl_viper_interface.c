@@ -243,6 +243,7 @@ void tpl_viper_start_one_shot_timer(int sig, unsigned long delay)
     command_to_send.params.timer.type = ONE_SHOT;
     command_to_send.params.timer.delay = delay;
     command_to_send.params.timer.sig = sig;
+    command_to_send.params.timer.line = NO_LINE;
     
     send_viper_command(&command_to_send);
 }
@@ -255,10 +256,171 @@ void tpl_viper_start_auto_timer(int sig, unsigned long delay)
     command_to_send.params.timer.type = AUTO;
     command_to_send.params.timer.delay = delay;
     command_to_send.params.timer.sig = sig;
+    command_to_send.params.timer.line = NO_LINE;
     
     send_viper_command(&command_to_send);
 }
 
+#if WITH_POSIX_RT_IRQ == YES
+extern const int tpl_isr_for_irq_line[TPL_IRQ_LINE_COUNT];
+extern const int tpl_signal_for_irq_line[TPL_IRQ_LINE_COUNT];
+
+/*
+ * tpl_viper_start_irq_line_timer starts a timer that raises an interrupt
+ * line: viper sends the real time signal of the line with the line as
+ * payload.
+ */
+static void tpl_viper_start_irq_line_timer(
+    int type, unsigned int line, unsigned long delay)
+{
+    vp_command command_to_send;
+    
+    command_to_send.command = TIMER;
+    command_to_send.params.timer.type = type;
+    command_to_send.params.timer.delay = delay;
+    command_to_send.params.timer.sig = SIGRTMIN + tpl_signal_for_irq_line[line];
+    command_to_send.params.timer.line = (int)line;
+    
+    send_viper_command(&command_to_send);
+}
+
+void tpl_viper_start_one_shot_irq_line(unsigned int line, unsigned long delay)
+{
+    tpl_viper_start_irq_line_timer(ONE_SHOT, line, delay);
+}
+
+void tpl_viper_start_auto_irq_line(unsigned int line, unsigned long delay)
+{
+    tpl_viper_start_irq_line_timer(AUTO, line, delay);
+}
+#endif /* WITH_POSIX_RT_IRQ */
+
+/*
+ * tpl_viper_event_param fills the parameters of an event file replay.
+ * The real time signal of each line is taken from the goil tables.
+ */
+static void tpl_viper_event_param(
+    vp_event_param *param, const char *file_name, int sig, unsigned long tolerance)
+{
+    int line;
+    
+    strncpy(param->file_name, file_name, sizeof(param->file_name) - 1);
+    param->file_name[sizeof(param->file_name) - 1] = '\0';
+    param->sig = sig;
+    param->tolerance = tolerance;
+    for (line = 0; line < VP_EVENT_LINE_COUNT; line++) {
+        param->line_signal[line] = VP_NO_SIGNAL;
+#if WITH_POSIX_RT_IRQ == YES
+        if ((line < TPL_IRQ_LINE_COUNT) && (tpl_isr_for_irq_line[line] >= 0)) {
+            param->line_signal[line] = (unsigned char)tpl_signal_for_irq_line[line];
+        }
+#endif
+    }
+}
+
+/*
+ * tpl_viper_play_events makes viper replay an event file (see
+ * VP_EVENT_RECORD in viper.h). The events without line send sig. The
+ * events with a line send the real time signal of the line. An event
+ * sent more than tolerance microseconds after its date misses its
+ * deadline. Viper reports the replay on stderr when it is over.
+ */
+void tpl_viper_play_events(const char *file_name, int sig, unsigned long tolerance)
+{
+    vp_command command_to_send;
+    
+    command_to_send.command = EVENT;
+    tpl_viper_event_param(&(command_to_send.params.event), file_name, sig, tolerance);
+    
+    send_viper_command(&command_to_send);
+}
+
+#if WITH_POSIX_VIRTUAL_TIME == YES
+/*
+ * tpl_viper_start_virtual_time switches viper to virtual time. It is
+ * sent before any timer.
+ */
+void tpl_viper_start_virtual_time(void)
+{
+    vp_command command_to_send;
+    
+    command_to_send.command = VTIME;
+    command_to_send.params.vtime.seed = TPL_VIRTUAL_TIME_SEED;
+    strncpy(command_to_send.params.vtime.log_file, TPL_VIRTUAL_TIME_LOG,
+            sizeof(command_to_send.params.vtime.log_file) - 1);
+    command_to_send.params.vtime.log_file[
+        sizeof(command_to_send.params.vtime.log_file) - 1] = '\0';
+    tpl_viper_event_param(&(command_to_send.params.vtime.replay),
+                          TPL_VIRTUAL_TIME_REPLAY, 0, 0);
+    
+    send_viper_command(&command_to_send);
+}
+
+/*
+ * tpl_viper_advance is called when the application is idle. Viper moves
+ * the virtual date to the next event and the event is raised here. The
+ * signal is not blocked so it is handled before kill or sigqueue
+ * returns. It returns 0 when no event is pending anymore.
+ */
+int tpl_viper_advance(void)
+{
+    vp_command command_to_send;
+    vp_virtual_event event;
+    
+    command_to_send.command = ADVANCE;
+    send_viper_command(&command_to_send);
+    
+    event = status->event;
+    if (event.sig == 0) {
+        return 0;
+    }
+    if (event.line == NO_LINE) {
+        kill(getpid(), event.sig);
+    }
+    else {
+        union sigval value;
+        value.sival_int = (int)(((event.payload & VP_LINE_MASK) << VP_PAYLOAD_SHIFT) |
+                                ((unsigned int)event.line & VP_LINE_MASK));
+        sigqueue(getpid(), event.sig, value);
+    }
+    return 1;
+}
+
+/*
+ * tpl_viper_get_date returns the virtual date in nanoseconds
+ */
+unsigned long long tpl_viper_get_date(void)
+{
+    return status->date;
+}
+#endif /* WITH_POSIX_VIRTUAL_TIME */
+
+#if WITH_TRACE == YES
+/*
+ * tpl_viper_get_trace_control copies the trace control written by the
+ * host when it changed since *seq and returns 1, or returns 0. A copy
+ * torn by a write of viper is dropped and done again at the next call.
+ */
+int tpl_viper_get_trace_control(unsigned int *seq, vp_trace_ctrl *control)
+{
+    unsigned int new_seq = ctrl->trace.seq;
+
+    if (new_seq == *seq || (new_seq & 1) != 0)
+    {
+        return 0;
+    }
+    __sync_synchronize();
+    *control = ctrl->trace;
+    __sync_synchronize();
+    if (ctrl->trace.seq != new_seq)
+    {
+        return 0;
+    }
+    *seq = new_seq;
+    return 1;
+}
+#endif /* WITH_TRACE */
+
 int tpl_viper_get_motor_pos(int motor)
 {
     if (motor >= 0 && motor < 2) {
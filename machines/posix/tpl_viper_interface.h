@@ -21,6 +21,21 @@
 extern void tpl_viper_init(void);
 extern void tpl_viper_start_one_shot_timer(int sig, unsigned long delay);
 extern void tpl_viper_start_auto_timer(int sig, unsigned long delay);
+#if WITH_POSIX_RT_IRQ == YES
+extern void tpl_viper_start_one_shot_irq_line(unsigned int line, unsigned long delay);
+extern void tpl_viper_start_auto_irq_line(unsigned int line, unsigned long delay);
+extern unsigned int tpl_viper_irq_payload(void);
+#endif
+extern void tpl_viper_play_events(const char *file_name, int sig, unsigned long tolerance);
+#if WITH_POSIX_VIRTUAL_TIME == YES
+extern void tpl_viper_start_virtual_time(void);
+extern int  tpl_viper_advance(void);
+extern unsigned long long tpl_viper_get_date(void);
+#endif
+#if WITH_TRACE == YES
+struct VP_TRACE_CTRL;
+extern int  tpl_viper_get_trace_control(unsigned int *seq, struct VP_TRACE_CTRL *control);
+#endif
 extern int  tpl_viper_get_motor_pos(int motor);
 extern void tpl_viper_set_motor_csg(int motor, int csg);
 
@@ -35,6 +35,22 @@
 
 #define IDLE_STACK_SIZE 200
 
+/*
+ * Size of a line of the data cache of the e200z4 cores. goil pads the
+ * per core kernel state to a multiple of it.
+ */
+#define TPL_CACHE_LINE_SIZE 32
+
+/*
+ * TPL_CACHE_LINE_ALIGNED aligns a variable on a cache line when the
+ * compiler allows it.
+ */
+#if defined (__GNUC__) || defined(__DIABDATA__)
+  #define TPL_CACHE_LINE_ALIGNED __attribute__((aligned(TPL_CACHE_LINE_SIZE)))
+#else
+  #define TPL_CACHE_LINE_ALIGNED
+#endif
+
 typedef uint32 tpl_stack_word;
 typedef uint32 tpl_stack_size;
 
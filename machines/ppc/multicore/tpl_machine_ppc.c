@@ -46,10 +46,7 @@ VAR(uint32, OS_VAR)   tpl_current_date[NUMBER_OF_CORES];
 extern FUNC(void, OS_CODE) tpl_slave_core_startup();
 #endif
 
-#if WITH_MULTICORE == YES
-extern volatile VAR(uint32, OS_VAR) tpl_locking_depth[NUMBER_OF_CORES];
-extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock[NUMBER_OF_CORES];
-#else
+#if WITH_MULTICORE == NO
 extern volatile VAR(uint32, OS_VAR) tpl_locking_depth;
 extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock;
 #endif
@@ -233,7 +230,7 @@ FUNC(void, OS_CODE) tpl_fill_stack_pattern(void)
 for (i = 0; i < TASK_COUNT; i++) {
 # if NUMBER_OF_CORES > 1
     /* In multicore, we must check if the task belongs to the core */
-    if (tpl_stat_proc_table[i]->core_id == core_id)
+    if (TPL_PROC_CORE_ID(i) == core_id)
 # endif
     {
       /*
@@ -258,7 +255,7 @@ for (i = 0; i < TASK_COUNT; i++) {
   {
 # if NUMBER_OF_CORES > 1
     /* In multicore, we must check if the task belongs to the core */
-    if (tpl_stat_proc_table[i]->core_id == core_id)
+    if (TPL_PROC_CORE_ID(i) == core_id)
 # endif
     {
       /*
@@ -466,6 +463,31 @@ FUNC(void, OS_CODE) tpl_try_to_get_lock(
 }
 
 
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap is done inside the TPL_GATE_LOCK hardware gate, so
+ * it is atomic regarding the other core.
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(volatile uint32, AUTOMATIC, OS_VAR) addr,
+  CONST(uint32, AUTOMATIC)                       expected,
+  CONST(uint32, AUTOMATIC)                       desired)
+{
+  VAR(tpl_bool, AUTOMATIC) swapped = FALSE;
+
+  tpl_get_spin_lock(TPL_GATE_LOCK);
+  if (*addr == expected)
+  {
+    *addr = desired;
+    swapped = TRUE;
+  }
+  tpl_release_spin_lock(TPL_GATE_LOCK);
+
+  return swapped;
+}
+
+
 /**
  * @internal
  *
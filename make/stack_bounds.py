@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+#
+# Bounds the stack of each task and ISR2 from the call graph written by
+# gcc with -fstack-usage -fcallgraph-info=su (see BUILD::STACK_ANALYSIS)
+# and compares the bounds with STACKSIZE.
+#
+# usage: stack_bounds.py stack_procs.txt build_dir [stack_bounds.txt]
+#
+# stack_procs.txt is generated by goil. The bound of a process is:
+#  - the frames of the CONTEXT functions the target runs below the entry
+#    function of a process, plus CONTEXT_FRAME;
+#  - the depth of the call graph of its entry function, kernel services
+#    included since they run on the stack of the caller;
+#  - the deepest INTERRUPT function, plus INTERRUPT_FRAME, since an
+#    interrupt is handled on the stack of the process it interrupts.
+#
+# An indirect call is bounded by the deepest INDIRECT function (expiry
+# functions of the alarms and schedule tables, message notifications,
+# ISR1). A call to a function compiled without the analysis (libc, ...)
+# counts EXTERNAL bytes. A recursion or a dynamic
+# stack allocation that gcc can not bound gives an unbounded stack.
+
+import os
+import re
+import sys
+
+NODE = re.compile(r'node: \{ title: "([^"]*)" label: "([^"]*)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+FRAME = re.compile(r'(\d+) bytes \(([^)]*)\)')
+
+INDIRECT_CALL = "__indirect_call"
+
+
+class CallGraph:
+    def __init__(self):
+        self.frame = {}        # function -> frame size
+        self.unbounded = {}    # function -> reason
+        self.callees = {}      # function -> set of callees
+        self.indirect = []     # targets of the indirect calls
+        self.external = 0      # bytes of a call to an unknown function
+        self.depths = {}
+
+    def load(self, path):
+        with open(path) as ci:
+            for line in ci:
+                node = NODE.search(line)
+                if node:
+                    frame = FRAME.search(node.group(2))
+                    if frame:
+                        self.frame[node.group(1)] = int(frame.group(1))
+                        if frame.group(2) == "dynamic":
+                            self.unbounded[node.group(1)] = \
+                                "dynamic stack in " + node.group(1)
+                    continue
+                edge = EDGE.search(line)
+                if edge:
+                    self.callees.setdefault(edge.group(1), set()).add(
+                        edge.group(2))
+
+    def depth(self, function, path=()):
+        """
+        Returns (bytes, reason, externals, indirect) for the deepest call
+        chain from function. reason is None when the depth is bounded.
+        """
+        if function in self.depths:
+            return self.depths[function]
+        if function in path:
+            return (0, "recursion in " + function, set(), set())
+        if function == INDIRECT_CALL:
+            result = (0, None, set(), set(path[-1:]))
+            for target in self.indirect:
+                result = self.deepest(result, self.depth(target, path))
+        elif function not in self.frame:
+            result = (self.external, None, set([function]), set())
+        else:
+            result = (0, None, set(), set())
+            for callee in sorted(self.callees.get(function, ())):
+                result = self.deepest(
+                    result, self.depth(callee, path + (function,)))
+            result = (result[0] + self.frame[function],
+                      self.unbounded.get(function, result[1]),
+                      result[2], result[3])
+        if function != INDIRECT_CALL:
+            # a recursion found below function goes through function
+            self.depths[function] = result
+        return result
+
+    @staticmethod
+    def deepest(a, b):
+        return (max(a[0], b[0]), a[1] or b[1], a[2] | b[2], a[3] | b[3])
+
+    @staticmethod
+    def stacked(a, b):
+        return (a[0] + b[0], a[1] or b[1], a[2] | b[2], a[3] | b[3])
+
+
+def round16(size):
+    return (size + 15) // 16 * 16
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit("usage: stack_bounds.py stack_procs.txt build_dir "
+                 "[stack_bounds.txt]")
+    graph = CallGraph()
+    for root, dirs, files in os.walk(sys.argv[2]):
+        for name in sorted(files):
+            if name.endswith(".ci"):
+                graph.load(os.path.join(root, name))
+
+    config = {"WASTE": 50, "CONTEXT_FRAME": 0, "INTERRUPT_FRAME": 0}
+    context = []
+    interrupts = []
+    procs = []
+    with open(sys.argv[1]) as description:
+        for line in description:
+            fields = line.split()
+            if not fields or fields[0].startswith("#"):
+                continue
+            if fields[0] in ("TASK", "ISR"):
+                procs.append(fields)
+            elif fields[0] == "CONTEXT":
+                context += fields[1:]
+            elif fields[0] == "INTERRUPT":
+                interrupts += fields[1:]
+            elif fields[0] == "INDIRECT":
+                graph.indirect += fields[1:]
+            elif fields[0] == "EXTERNAL":
+                graph.external = int(fields[1])
+            else:
+                config[fields[0]] = int(fields[1])
+
+    base = config["CONTEXT_FRAME"] + sum(graph.frame.get(f, 0)
+                                         for f in context)
+    interrupt = (0, None, set(), set())
+    for function in interrupts:
+        interrupt = graph.deepest(interrupt, graph.depth(function))
+    interrupt = (interrupt[0] + config["INTERRUPT_FRAME"],) + interrupt[1:]
+
+    bounds = {}
+    for kind, name, entry, size in (p[:4] for p in procs):
+        if entry not in graph.frame:
+            bounds[name] = None
+        else:
+            bounds[name] = graph.stacked(graph.depth(entry), interrupt)
+            bounds[name] = (bounds[name][0] + base,) + bounds[name][1:]
+    # a shared stack holds the deepest of the tasks that share it
+    for proc in procs:
+        if len(proc) > 4 and bounds.get(proc[1]) is not None:
+            owner = bounds.get(proc[4])
+            if owner is not None:
+                bounds[proc[4]] = graph.deepest(owner, bounds[proc[1]])
+
+    lines = ["# Stack bounds from the call graph, see stack_bounds.py",
+             "# %d bytes below the entry function, %d bytes for an "
+             "interrupt" % (base, interrupt[0]),
+             "#",
+             "# kind name STACKSIZE bound status"]
+    warnings = []
+    waste = 0
+    for proc in procs:
+        kind, name, entry, size = proc[0], proc[1], proc[2], int(proc[3])
+        bound = bounds[name]
+        if len(proc) > 4:
+            lines.append("%s %s %d - shared with %s" %
+                         (kind, name, size, proc[4]))
+            continue
+        if bound is None:
+            lines.append("%s %s %d - no call graph for %s" %
+                         (kind, name, size, entry))
+            continue
+        if bound[1] is not None:
+            status = "UNBOUNDED (%s)" % bound[1]
+            warnings.append("%s %s: %s, its stack can not be bounded" %
+                            (kind, name, bound[1]))
+        elif bound[0] > size:
+            status = "OVERFLOW by %d bytes" % (bound[0] - size)
+            warnings.append("%s %s: STACKSIZE %d is under the bound %d" %
+                            (kind, name, size, bound[0]))
+        elif size * 100 > bound[0] * (100 + config["WASTE"]):
+            status = "WASTE of %d bytes, STACKSIZE = %d would do" % (
+                size - round16(bound[0]), round16(bound[0]))
+            waste += size - round16(bound[0])
+        else:
+            status = "OK"
+        lines.append("%s %s %d %s%d %s" % (kind, name, size,
+                     ">=" if bound[1] is not None else "", bound[0], status))
+        if bound[2]:
+            lines.append("  # calls without stack usage (%d bytes each): %s"
+                         % (graph.external, " ".join(sorted(bound[2]))))
+        if bound[3]:
+            lines.append("  # indirect calls in: %s" %
+                         " ".join(sorted(bound[3])))
+    if waste > 0:
+        lines.append("# %d bytes of RAM could be saved" % waste)
+
+    report = "\n".join(lines) + "\n"
+    if len(sys.argv) > 3:
+        with open(sys.argv[3], "w") as output:
+            output.write(report)
+    else:
+        sys.stdout.write(report)
+    for warning in warnings:
+        print("warning: " + warning)
+
+
+if __name__ == "__main__":
+    main()
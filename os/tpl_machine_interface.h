@@ -196,6 +196,36 @@ extern FUNC(void, OS_CODE) tpl_set_tpwatchdog(
  */
 extern FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void);
 
+#ifdef TPL_TP_WATCHDOG_PER_KIND
+/**
+ * @internal
+ *
+ * On machines that define TPL_TP_WATCHDOG_PER_KIND, each core has one
+ * watchdog per kind (EXECUTIONBUDGET, RESOURCELOCK, ALLINTERRUPTLOCK and
+ * OSINTERRUPTLOCK). They replace #tpl_set_tpwatchdog and
+ * #tpl_cancel_tpwatchdog, and their expiration calls
+ * #tpl_watchdog_kind_expiration.
+ *
+ * @param kind  the watchdog of the current core to start
+ * @param delay time (in tpl_time unit) since now the watchdog expires
+ *              (cannot be zero)
+ */
+extern FUNC(void, OS_CODE) tpl_set_tpwatchdog_kind(
+    CONST(uint8, AUTOMATIC) kind,
+    CONST(tpl_time, AUTOMATIC) delay
+);
+
+/**
+ * @internal
+ *
+ * Cancels the watchdog kind of the current core. This has no effect if
+ * the watchdog has not been started before.
+ */
+extern FUNC(void, OS_CODE) tpl_cancel_tpwatchdog_kind(
+    CONST(uint8, AUTOMATIC) kind
+);
+#endif
+
 /**
  * @internal
  *
@@ -207,6 +237,38 @@ extern FUNC(void, OS_CODE) tpl_cancel_tpwatchdog(void);
 extern FUNC(tpl_time, OS_CODE) tpl_get_tptimer(void);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if WITH_STATS == YES
+/**
+ * @internal
+ *
+ * Free running timer used by default for the runtime statistics. The
+ * machines that provide it give its unit in their documentation.
+ *
+ * @return the current date when called
+ */
+extern FUNC(tpl_stats_time, OS_CODE) tpl_get_stats_time(void);
+#endif /* WITH_STATS */
+
+#if WITH_LATENCY == YES
+/**
+ * @internal
+ *
+ * Sends the latency histograms of the ISR2 and of the alarms to the
+ * host (see tpl_os_latency_kernel.h). Called by the DumpLatency service.
+ */
+extern FUNC(void, OS_CODE) tpl_dump_latency(void);
+#endif /* WITH_LATENCY */
+
+#if WITH_STACK_REPORT == YES
+/**
+ * @internal
+ *
+ * Sends the peak stack usage of the tasks and ISR2 to the host. Called
+ * by the DumpStackUsage service and at shutdown.
+ */
+extern FUNC(void, OS_CODE) tpl_dump_stack_usage(void);
+#endif /* WITH_STACK_REPORT */
+
 #if WITH_STACK_MONITORING == YES
 /**
  * @internal
@@ -285,6 +347,21 @@ FUNC(void, OS_CODE) tpl_get_lock(
 FUNC(void, OS_CODE) tpl_release_lock(
   CONSTP2VAR(tpl_lock, AUTOMATIC, OS_VAR) lock);
 
+/**
+ * @internal
+ *
+ * tpl_compare_and_swap atomically stores desired in *addr if *addr is
+ * equal to expected. It is used by the lock-free parts of the kernel and
+ * has to act as a full memory barrier.
+ *
+ * @retval  TRUE  the swap has been done
+ * @retval  FALSE *addr was not equal to expected, nothing was done
+ */
+FUNC(tpl_bool, OS_CODE) tpl_compare_and_swap(
+  CONSTP2VAR(volatile uint32, AUTOMATIC, OS_VAR) addr,
+  CONST(uint32, AUTOMATIC)                       expected,
+  CONST(uint32, AUTOMATIC)                       desired);
+
 #endif
 
 #define OS_STOP_SEC_CODE
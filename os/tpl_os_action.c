@@ -62,19 +62,28 @@ FUNC(void, OS_CODE) tpl_action_activate_task(
    * first member of tpl_task_activation_action is a tpl_action
    * This cast behaves correctly.
    */
+  tpl_expire_activate_task(
+    ((P2CONST(tpl_task_activation_action,
+      AUTOMATIC,
+      OS_APPL_CONST))action)->task_id);
+}
 
+/**
+ *  task activation of an alarm or of an expiry point, with the task id
+ *  given by goil as a constant
+ */
+FUNC(void, OS_CODE) tpl_expire_activate_task(
+  CONST(tpl_task_id, AUTOMATIC) task_id)
+{
   /*  init the error to no error  */
   VAR(StatusType, AUTOMATIC) result_action = E_OK;
 
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_ActivateTask)
-  STORE_TASK_ID(((P2CONST(tpl_task_activation_action, AUTOMATIC, OS_APPL_CONST))action)->task_id)
+  STORE_TASK_ID(task_id)
 
   /* call alarm action and save return value to launch error hook if alarm action goes wrong */
-  result_action = tpl_activate_task(
-    ((P2CONST(tpl_task_activation_action,
-      AUTOMATIC,
-      OS_APPL_CONST))action)->task_id);
+  result_action = tpl_activate_task(task_id);
 
   PROCESS_ERROR(result_action)
 }
@@ -93,19 +102,29 @@ FUNC(void, OS_CODE) tpl_action_setevent(
    * first member of tpl_setevent_action is a tpl_action
    * This cast behaves correctly.
    */
+  tpl_expire_setevent(
+      ((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->task_id,
+      ((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->mask
+  );
+}
 
+/**
+ *  event setting of an alarm or of an expiry point, with the task id and
+ *  the mask given by goil as constants
+ */
+FUNC(void, OS_CODE) tpl_expire_setevent(
+  CONST(tpl_task_id, AUTOMATIC)     task_id,
+  CONST(tpl_event_mask, AUTOMATIC)  mask)
+{
   /*  init the error to no error  */
   VAR(StatusType, AUTOMATIC) result_action = E_OK;
 
   /*  store information for error hook routine    */
   STORE_SERVICE(OSServiceId_SetEvent)
-  STORE_TASK_ID(((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->task_id)
-  STORE_EVENT_MASK(((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->mask)
+  STORE_TASK_ID(task_id)
+  STORE_EVENT_MASK(mask)
   /* call alarm action and save return value to launch error hook if alarm action goes wrong */
-  result_action = tpl_set_event(
-      ((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->task_id,
-      ((P2CONST(tpl_setevent_action, AUTOMATIC, OS_APPL_CONST))action)->mask
-  );
+  result_action = tpl_set_event(task_id, mask);
 
   PROCESS_ERROR(result_action);
 }
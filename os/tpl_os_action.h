@@ -136,6 +136,17 @@ FUNC(void, OS_CODE) tpl_action_setevent(
   P2CONST(tpl_action, AUTOMATIC, OS_APPL_CONST) action
 );
 
+/*
+ * Actions called directly by the expiry functions generated by goil
+ */
+FUNC(void, OS_CODE) tpl_expire_activate_task(
+  CONST(tpl_task_id, AUTOMATIC) task_id
+);
+FUNC(void, OS_CODE) tpl_expire_setevent(
+  CONST(tpl_task_id, AUTOMATIC)     task_id,
+  CONST(tpl_event_mask, AUTOMATIC)  mask
+);
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -31,6 +31,7 @@
 #include "tpl_os_errorhook.h"
 #include "tpl_machine_interface.h"
 #include "tpl_trace.h"
+#include "tpl_os_latency_kernel.h"
 
 #include "tpl_debug.h"
 
@@ -55,36 +56,6 @@ CONST(tpl_alarm_id, AUTOMATIC) INVALID_ALARM = (-1);
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
-/**
- * @internal
- *
- * tpl_raise_alarm is called by tpl_counter_tick
- * when an alarm time object is raised.
- *
- * @param time_obj  The alarm to raise.
- */
-FUNC(void, OS_CODE) tpl_raise_alarm(
-    P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
-{
-  /*
-   * A tpl_time_obj_static * is cast to a tpl_alarm_static *
-   * This violate MISRA rule 45. However, since the
-   * first member of tpl_alarm_static is a tpl_time_obj_static
-   * This cast behaves correctly.
-   */
-  /*  Get the alarm descriptor                            */
-  P2VAR(tpl_alarm_static, AUTOMATIC, OS_APPL_DATA) stat_alarm =
-    (tpl_alarm_static *)time_obj->stat_part;
-  /*  Get the action to perform from the alarm descriptor */
-  CONSTP2VAR(tpl_action, AUTOMATIC, OS_APPL_CONST) action_desc =
-    stat_alarm->action;
-
-  TRACE_ALARM_EXPIRE(time_obj)
-  /*  Call the action                                     */
-  (action_desc->action)(action_desc) ;
-}
-
-
 FUNC(tpl_status, OS_CODE) tpl_get_alarm_base_service(
     CONST(tpl_alarm_id, AUTOMATIC)                  alarm_id,
     P2VAR(tpl_alarm_base, AUTOMATIC, OS_APPL_DATA)  info)
@@ -200,20 +171,67 @@ FUNC(tpl_status, OS_CODE) tpl_get_alarm_service(
   return result;
 }
 
-FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_service(
+#if ALARM_COUNT > 0
+/*
+ * Sets the alarm alarm_id relative to the current date of its counter,
+ * the kernel being locked. Used by the SetRelAlarm services once the
+ * arguments are checked.
+ */
+STATIC FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm(
   CONST(tpl_alarm_id, AUTOMATIC)  alarm_id,
   CONST(tpl_tick, AUTOMATIC)      increment,
   CONST(tpl_tick, AUTOMATIC)      cycle)
 {
-  GET_CURRENT_CORE_ID(core_id)
   VAR(tpl_status, AUTOMATIC) result = E_OK;
-
-#if ALARM_COUNT > 0
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) alarm;
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) cnt;
   VAR(tpl_tick, AUTOMATIC) date;
+
+  alarm = tpl_alarm_table[alarm_id];
+  /* Tick optimization :
+   * A syscall must update counters before using a timeobj's structures
+   */
+  TPL_UPDATE_COUNTERS(alarm);
+
+  if (alarm->state == (tpl_time_obj_state)ALARM_SLEEP)
+  {
+    cnt = alarm->stat_part->counter;
+    /*  the alarm is not in use, proceed    */
+    date = cnt->current_date + increment;
+    if (date > cnt->max_allowed_value)
+    {
+        date -= (cnt->max_allowed_value + 1);
+    }
+    alarm->date = date;
+    alarm->cycle = cycle;
+    alarm->state = ALARM_ACTIVE;
+    tpl_insert_time_obj(alarm);
+    TRACE_ALARM_SCHEDULED(alarm);
+  }
+  else
+  {
+    /*  the alarm is in use, return the proper error code   */
+    result = E_OS_STATE;
+  }
+
+  /* Tick optimization :
+   * A syscall must enable the mastersource after finishing using the timeobj
+   * structure.
+   */
+  TPL_ENABLE_SHAREDSOURCE(alarm);
+
+  return result;
+}
 #endif
 
+FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_service(
+  CONST(tpl_alarm_id, AUTOMATIC)  alarm_id,
+  CONST(tpl_tick, AUTOMATIC)      increment,
+  CONST(tpl_tick, AUTOMATIC)      cycle)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
   LOCK_KERNEL()
 
 /* check interrupts are not disabled by user    */
@@ -235,38 +253,49 @@ FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_service(
 #if ALARM_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-    alarm = tpl_alarm_table[alarm_id];
-    /* Tick optimization :
-     * A syscall must update counters before using a timeobj's structures
-     */
-    TPL_UPDATE_COUNTERS(alarm);
+    result = tpl_set_rel_alarm(alarm_id, increment, cycle);
+  }
+#endif
 
-    if (alarm->state == (tpl_time_obj_state)ALARM_SLEEP)
-    {
-      cnt = alarm->stat_part->counter;
-      /*  the alarm is not in use, proceed    */
-      date = cnt->current_date + increment;
-      if (date > cnt->max_allowed_value)
-      {
-          date -= (cnt->max_allowed_value + 1);
-      }
-      alarm->date = date;
-      alarm->cycle = cycle;
-      alarm->state = ALARM_ACTIVE;
-      tpl_insert_time_obj(alarm);
-      TRACE_ALARM_SCHEDULED(alarm)
-    }
-    else
-    {
-      /*  the alarm is in use, return the proper error code   */
-      result = E_OS_STATE;
-    }
+  PROCESS_ERROR(result)
 
-    /* Tick optimization :
-     * A syscall must enable the mastersource after finishing using the timeobj
-     * structure.
-     */
-    TPL_ENABLE_SHAREDSOURCE(alarm);
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+/*
+ * SetRelAlarm_<alarm>: the alarm id is a constant of the OIL file, there
+ * is no id check.
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_static_service(
+  CONST(tpl_alarm_id, AUTOMATIC)  alarm_id,
+  CONST(tpl_tick, AUTOMATIC)      increment,
+  CONST(tpl_tick, AUTOMATIC)      cycle)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_SetRelAlarm)
+  STORE_ALARM_ID(alarm_id)
+  STORE_TICK_1(increment)
+  STORE_TICK_2(cycle)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_ALARM_ID(core_id, alarm_id,result)
+
+  CHECK_ALARM_INCREMENT_ERROR(alarm_id,increment,result)
+  CHECK_ALARM_MIN_CYCLE_ERROR(alarm_id,cycle,result)
+
+#if ALARM_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_set_rel_alarm(alarm_id, increment, cycle);
   }
 #endif
 
@@ -328,7 +357,7 @@ FUNC(tpl_status, OS_CODE) tpl_set_abs_alarm_service(
       alarm->cycle = cycle;
       alarm->state = ALARM_ACTIVE;
       tpl_insert_time_obj(alarm);
-      TRACE_ALARM_SCHEDULED(alarm)
+      TRACE_ALARM_SCHEDULED(alarm);
     }
     else
     {
@@ -391,7 +420,7 @@ FUNC(tpl_status, OS_CODE) tpl_cancel_alarm_service(
     if (alarm->state == (tpl_time_obj_state)ALARM_ACTIVE)
     {
       tpl_remove_time_obj(alarm);
-      TRACE_ALARM_CANCEL(alarm_id)
+      TRACE_ALARM_CANCEL(alarm_id);
       alarm->state = ALARM_SLEEP;
     }
     else
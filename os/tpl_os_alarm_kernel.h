@@ -66,17 +66,6 @@ struct TPL_ALARM_STATIC {
  */
 typedef struct TPL_ALARM_STATIC tpl_alarm_static;
 
-/**
- * @internal
- *
- * tpl_raise_alarm is called by tpl_counter_tick
- * when an alarm time object is raised.
- *
- * @param time_obj  The alarm to raise.
- */
-FUNC(void, OS_CODE) tpl_raise_alarm(
-    P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj);
-
 /**
  * @internal
  *
@@ -131,6 +120,27 @@ FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_service(
     CONST(tpl_tick, AUTOMATIC)      increment,
     CONST(tpl_tick, AUTOMATIC)      cycle);
 
+/**
+ * Set an alarm whose identifier is a constant of the OIL file, relative
+ * to the current date of its counter.
+ *
+ * It is called by the SetRelAlarm_<alarm> macros goil generates in
+ * tpl_os.h. Since alarm_id is valid by construction, it is not checked.
+ *
+ * @param alarm_id identifier of the alarm
+ * @param increment relative ticks to set
+ * @param cycle number of cycles after next expiration (0 if unused)
+ *
+ * @retval E_OK no error
+ * @retval E_OS_STATE alarm is already in use
+ * @retval E_OS_VALUE (extended error only) increment or cycle is outside of
+ * limits
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_rel_alarm_static_service(
+    CONST(tpl_alarm_id, AUTOMATIC)  alarm_id,
+    CONST(tpl_tick, AUTOMATIC)      increment,
+    CONST(tpl_tick, AUTOMATIC)      cycle);
+
 
 /**
  * @internal
@@ -46,11 +46,26 @@ typedef P2VAR(uint8, TYPEDEF, OS_APPL_DATA) tpl_buffer;
 
 /**
  * Time data (duration or date) used in timing protection. The unit is system
- * dependant (see #tpl_get_local_current_date)).
+ * dependant (see #tpl_get_local_current_date)). A machine with a fine grained
+ * timer defines TPL_TIME_64BIT in its tpl_os_std_types.h.
  *
  * @see #tpl_get_local_current_date
  */
+#ifdef TPL_TIME_64BIT
+typedef uint64 tpl_time;
+#else
 typedef uint32 tpl_time;
+#endif
+
+/**
+ * Dates and durations of the runtime statistics, in the unit of the timer
+ * given by the STATS attribute of the OS object.
+ */
+#ifdef TPL_TIME_64BIT
+typedef uint64 tpl_stats_time;
+#else
+typedef uint32 tpl_stats_time;
+#endif
 
 #endif /* TPL_OS_CUSTOM_TYPES_H */
 
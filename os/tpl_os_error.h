@@ -1551,7 +1551,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 #   define CHECK_RESOURCE_PRIO_ERROR_ON_GET(core_id, res, result) \
     if ((result == (tpl_status)E_OK) &&                           \
         (((res)->owner != INVALID_TASK) ||                        \
-         (TPL_KERN(core_id).s_running->base_priority >            \
+         (TPL_PROC_BASE_PRIORITY(TPL_KERN(core_id).running_id) >  \
           res->ceiling_priority)))                                \
     {                                                             \
         result = (tpl_status)E_OS_ACCESS;                         \
@@ -1575,7 +1575,7 @@ tpl_service.parameters.id.spinlock_id = (spinlockid);
 #if WITH_OS_EXTENDED == YES
 #   define CHECK_RESOURCE_PRIO_ERROR_ON_RELEASE(a_core_id, res, result) \
     if ((result == (tpl_status)E_OK) &&                                 \
-        (TPL_KERN(a_core_id).s_running->base_priority >                 \
+        (TPL_PROC_BASE_PRIORITY(TPL_KERN(a_core_id).running_id) >      \
          (res)->ceiling_priority))                                      \
     {                                                                   \
         result = (tpl_status)E_OS_ACCESS;                               \
@@ -99,6 +99,54 @@ FUNC(tpl_status, OS_CODE) tpl_set_event_service(
 }
 
 
+/*
+ * SetEvent_<task>: the task id is a constant of the OIL file and the task
+ * is an extended one, there is no id check.
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_event_static_service(
+  CONST(tpl_task_id, AUTOMATIC)       task_id,
+  CONST(tpl_event_mask, AUTOMATIC)    event)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_PROC_CORE_ID(task_id, proc_core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_SetEvent)
+  STORE_TASK_ID(task_id)
+  STORE_EVENT_MASK(event)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_TASK_ID(core_id, task_id,result)
+
+  /*  checks the task is not in the SUSPENDED state   */
+  CHECK_SUSPENDED_TASK_ERROR(task_id,result)
+
+#if EXTENDED_TASK_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_set_event(task_id, event);
+    if (result == E_OK && TPL_KERN(proc_core_id).need_schedule)
+    {
+      tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
+      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+    }
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+
 /*
  * tpl_clear_event_service
  */
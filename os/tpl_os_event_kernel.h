@@ -51,6 +51,24 @@ FUNC(tpl_status, OS_CODE) tpl_set_event_service(
     CONST(tpl_task_id, AUTOMATIC)       task_id,
     CONST(tpl_event_mask, AUTOMATIC)    event);
 
+/**
+ * Set events of an extended task whose identifier is a constant of the
+ * OIL file.
+ *
+ * It is called by the SetEvent_<task> macros goil generates in tpl_os.h
+ * for the extended tasks only, so task_id is neither checked for its
+ * range nor for its kind.
+ *
+ * @param   task_id     identifier of the task for which events will be set
+ * @param   event       event mask for selected event bits
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_STATE  (extended error only) referenced task is suspended
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_event_static_service(
+    CONST(tpl_task_id, AUTOMATIC)       task_id,
+    CONST(tpl_event_mask, AUTOMATIC)    event);
+
 
 /**
  * Clear event of current task
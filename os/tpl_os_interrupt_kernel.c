@@ -29,6 +29,8 @@
 #include "tpl_os_errorhook.h"
 #include "tpl_machine_interface.h"
 #include "tpl_trace.h"
+#include "tpl_os_stats_kernel.h"
+#include "tpl_os_latency_kernel.h"
 #include "tpl_os_interrupt_kernel.h"
 
 #if defined(__unix__) || defined(__APPLE__)
@@ -55,13 +57,11 @@
  * the following variableѕ should not be initialized at definition,
  * or Memmap section is not the right one
  */
-#if NUMBER_OF_CORES > 1
-volatile VAR(uint32, OS_VAR) tpl_locking_depth[NUMBER_OF_CORES];
-VAR(tpl_bool, OS_VAR) tpl_user_task_lock[NUMBER_OF_CORES];
-VAR(uint32, OS_VAR) tpl_cpt_user_task_lock_All[NUMBER_OF_CORES];
-VAR(uint32, OS_VAR) tpl_cpt_user_task_lock_OS[NUMBER_OF_CORES];
-VAR(uint32, OS_VAR) tpl_cpt_os_task_lock[NUMBER_OF_CORES];
-#else
+/*
+ * In multicore, the lock counters are members of the tpl_core_state of
+ * each core (see GET_LOCK_CNT_FOR_CORE).
+ */
+#if NUMBER_OF_CORES == 1
 volatile VAR(uint32, OS_VAR) tpl_locking_depth = 0;
 VAR(tpl_bool, OS_VAR) tpl_user_task_lock = FALSE;
 VAR(uint32, OS_VAR) tpl_cpt_user_task_lock_All = 0;
@@ -291,7 +291,7 @@ STATIC FUNC(void, OS_CODE) tpl_activate_isr(
    * MISRA RULE 33 VIOLATION: the right statement does
    * not need to be executed if the first test fails
    */
-  if ((isr->activate_count < tpl_stat_proc_table[isr_id]->max_activate_count)
+  if ((isr->activate_count < TPL_PROC_MAX_ACTIVATE_COUNT(isr_id))
 #if WITH_AUTOSAR == YES
       && (tpl_is_isr2_enabled(isr_id))
 #endif
@@ -303,6 +303,7 @@ STATIC FUNC(void, OS_CODE) tpl_activate_isr(
     if (TRUE == tpl_tp_on_activate_or_release(isr_id))
     {
 #endif
+      STATS_PROC_ACTIVATE(isr_id);
       if (isr->activate_count == 0)
       {
         /*  check the isr is in the SUSPENDED state before moving it        */
@@ -344,6 +345,8 @@ FUNC(void, OS_CODE) tpl_central_interrupt_handler(
   P2CONST(tpl_isr_static, AUTOMATIC, OS_APPL_DATA) isr;
   GET_CURRENT_CORE_ID(core_id)
 
+  STATS_IRQ_ENTRY();
+
 #if WITH_STACK_MONITORING == YES
     GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
     tpl_check_stack((tpl_proc_id)TPL_KERN_REF(kern).running_id);
@@ -408,6 +411,8 @@ FUNC(void, OS_CODE) tpl_fast_central_interrupt_handler(
   P2CONST(tpl_isr_static, AUTOMATIC, OS_APPL_DATA) isr;
   GET_CURRENT_CORE_ID(core_id)
 
+  STATS_IRQ_ENTRY();
+
 #if WITH_STACK_MONITORING == YES
     GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
     tpl_check_stack((tpl_proc_id)TPL_KERN_REF(kern).running_id);
@@ -464,7 +469,7 @@ FUNC(void, OS_CODE) tpl_mask_isr2_priority(
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONST(tpl_priority, AUTOMATIC) index =
-    tpl_stat_proc_table[proc_id]->base_priority - ISR2_LOWEST_PRIO;
+    TPL_PROC_BASE_PRIORITY(proc_id) - ISR2_LOWEST_PRIO;
   tpl_disable_table[index]();
 }
 
@@ -480,7 +485,7 @@ extern FUNC(void, OS_CODE) tpl_unmask_isr2_priority(
   CONST(tpl_proc_id, AUTOMATIC) proc_id)
 {
   CONST(tpl_priority, AUTOMATIC) index =
-    tpl_stat_proc_table[proc_id]->base_priority - ISR2_LOWEST_PRIO;
+    TPL_PROC_BASE_PRIORITY(proc_id) - ISR2_LOWEST_PRIO;
   tpl_enable_table[index]();
 }
 
@@ -117,6 +117,22 @@ extern CONSTP2CONST(tpl_isr_static, AUTOMATIC, OS_APPL_DATA)
 
 #endif /* ISR_COUNT */
 
+#if NUMBER_OF_CORES == 1
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/*
+ * Lock counters of the kernel, the ports that lock the interrupts use
+ * them too. In multicore they are in the tpl_core_state of each core.
+ */
+extern volatile VAR(uint32, OS_VAR) tpl_locking_depth;
+extern VAR(tpl_bool, OS_VAR) tpl_user_task_lock;
+extern VAR(uint32, OS_VAR) tpl_cpt_os_task_lock;
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+#endif
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 /**
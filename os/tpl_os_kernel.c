@@ -34,6 +34,7 @@
 #include "tpl_machine_interface.h"
 #include "tpl_dow.h"
 #include "tpl_trace.h"
+#include "tpl_os_stats_kernel.h"
 #include "tpl_os_interrupt.h"
 #include "tpl_os_interrupt_kernel.h"
 #include "tpl_os_resource_kernel.h"
@@ -57,6 +58,9 @@
 #if SPINLOCK_COUNT > 0
 # include "tpl_as_spinlock_kernel.h"
 #endif
+#if WITH_EXTERNAL_COM == YES
+# include "tpl_com_external_com.h"
+#endif
 
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -343,13 +347,36 @@ FUNC(void, OS_CODE) tpl_put_new_proc(
   VAR(uint32, AUTOMATIC) index = (uint32)(++(READY_LIST(ready_list)[0].key));
 
   VAR(tpl_priority, AUTOMATIC) dyn_prio;
-  CONST(tpl_priority, AUTOMATIC) prio =
-    tpl_stat_proc_table[proc_id]->base_priority;
-  /*
-   * add the new entry at the end of the ready list
-   */
-  dyn_prio = (prio << PRIORITY_SHIFT) |
-             (--TAIL_FOR_PRIO(tail_for_prio)[prio] & RANK_MASK);
+  CONST(tpl_priority, AUTOMATIC) prio = TPL_PROC_BASE_PRIORITY(proc_id);
+#if WITH_EDF == YES
+  if (EDF_PRIORITY == prio)
+  {
+    /*
+     * In the EDF band, the rank is the opposite of the absolute deadline
+     * of the job and the tail is the opposite of the current date plus
+     * EDF_HALF_RANGE. The rank relative to the tail computed by
+     * tpl_compare_entries is then EDF_HALF_RANGE minus the deadline
+     * relative to the current date: it does not depend on the date and
+     * the earliest deadline, even if it is already missed, gets the
+     * highest rank as long as the deadlines are within EDF_HALF_RANGE of
+     * the current date.
+     */
+    CONST(tpl_tick, AUTOMATIC) date = tpl_edf_counter->current_date;
+    TAIL_FOR_PRIO(tail_for_prio)[prio] =
+      (tpl_rank_count)((0U - (uint32)(date + EDF_HALF_RANGE)) & RANK_MASK);
+    dyn_prio = (prio << PRIORITY_SHIFT) |
+      (tpl_priority)((0U - (uint32)(date + tpl_edf_deadline[proc_id])) &
+                     RANK_MASK);
+  }
+  else
+#endif
+  {
+    /*
+     * add the new entry at the end of the ready list
+     */
+    dyn_prio = (prio << PRIORITY_SHIFT) |
+               (--TAIL_FOR_PRIO(tail_for_prio)[prio] & RANK_MASK);
+  }
 
   DOW_DO(printf("put new %s, %d\n",proc_name_table[proc_id],dyn_prio);)
 
@@ -402,6 +429,85 @@ FUNC(void, OS_CODE) tpl_put_preempted_proc(
   DOW_DO(printrl("put_preempted_proc"));
 }
 
+/*
+ * @internal
+ *
+ * tpl_raise_preempted_proc raises the priority of a preempted proc to prio
+ * and moves it up in its ready list. It is used by the priority
+ * inheritance of the semaphores. Nothing is done if the proc has not
+ * been preempted (it is not in the ready list with its dynamic priority)
+ * or if it has already a higher priority.
+ */
+FUNC(void, OS_CODE) tpl_raise_preempted_proc(
+  CONST(tpl_proc_id, AUTOMATIC)   proc_id,
+  CONST(tpl_priority, AUTOMATIC)  prio)
+{
+  GET_PROC_CORE_ID(proc_id, core_id)
+  GET_CORE_READY_LIST(core_id, ready_list)
+  GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) proc =
+    tpl_dyn_proc_table[proc_id];
+  CONST(uint32, AUTOMATIC) size = (uint32)READY_LIST(ready_list)[0].key;
+  VAR(uint32, AUTOMATIC) index;
+
+  if (ACTUAL_PRIO(proc->priority) < prio)
+  {
+    for (index = 1; index <= size; index++)
+    {
+      if ((READY_LIST(ready_list)[index].id == proc_id) &&
+          (READY_LIST(ready_list)[index].key == proc->priority))
+      {
+        proc->priority = DYNAMIC_PRIO(prio, tail_for_prio);
+        READY_LIST(ready_list)[index].key = proc->priority;
+        tpl_bubble_up(
+          READY_LIST(ready_list),
+          index
+          TAIL_FOR_PRIO_ARG(tail_for_prio)
+        );
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @internal
+ *
+ * tpl_lower_preempted_proc gives back a lower dynamic priority to a proc
+ * raised by tpl_raise_preempted_proc and, if it has been preempted,
+ * moves it down in its ready list.
+ */
+FUNC(void, OS_CODE) tpl_lower_preempted_proc(
+  CONST(tpl_proc_id, AUTOMATIC)   proc_id,
+  CONST(tpl_priority, AUTOMATIC)  dyn_prio)
+{
+  GET_PROC_CORE_ID(proc_id, core_id)
+  GET_CORE_READY_LIST(core_id, ready_list)
+  GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+
+  CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA) proc =
+    tpl_dyn_proc_table[proc_id];
+  CONST(uint32, AUTOMATIC) size = (uint32)READY_LIST(ready_list)[0].key;
+  VAR(uint32, AUTOMATIC) index;
+
+  for (index = 1; index <= size; index++)
+  {
+    if ((READY_LIST(ready_list)[index].id == proc_id) &&
+        (READY_LIST(ready_list)[index].key == proc->priority))
+    {
+      READY_LIST(ready_list)[index].key = dyn_prio;
+      tpl_bubble_down(
+        READY_LIST(ready_list),
+        index
+        TAIL_FOR_PRIO_ARG(tail_for_prio)
+      );
+      break;
+    }
+  }
+  proc->priority = dyn_prio;
+}
+
 /**
  * @internal
  *
@@ -637,8 +743,9 @@ FUNC(P2CONST(tpl_context, AUTOMATIC, OS_CONST), OS_CODE)
      */
     CALL_POST_TASK_HOOK()
 
-    TRACE_ISR_PREEMPT((tpl_proc_id)TPL_KERN_REF(kern).running_id)
-    TRACE_TASK_PREEMPT((tpl_proc_id)TPL_KERN_REF(kern).running_id)
+    TRACE_ISR_PREEMPT((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+    TRACE_TASK_PREEMPT((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+    STATS_PROC_PREEMPT((tpl_proc_id)TPL_KERN_REF(kern).running_id);
 
     DOW_DO(printf(
       "tpl_run_elected preempt %s\n",
@@ -694,8 +801,9 @@ FUNC(P2CONST(tpl_context, AUTOMATIC, OS_CONST), OS_CODE)
   DOW_DO(printrl("tpl_run_elected - after"));
 
   /* the elected task become RUNNING */
-  TRACE_TASK_EXECUTE((tpl_proc_id)TPL_KERN_REF(kern).running_id)
-  TRACE_ISR_RUN((tpl_proc_id)TPL_KERN_REF(kern).running_id)
+  TRACE_TASK_EXECUTE((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+  TRACE_ISR_RUN((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+  STATS_PROC_RUN((tpl_proc_id)TPL_KERN_REF(kern).running_id);
   TPL_KERN_REF(kern).running->state = RUNNING;
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
@@ -783,6 +891,10 @@ FUNC(void, OS_CODE) tpl_schedule_from_running(CORE_ID_OR_VOID(core_id))
 {
   GET_CORE_READY_LIST(core_id, ready_list)
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+#if WITH_EDF == YES
+  GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+  VAR(tpl_heap_entry, AUTOMATIC) elected_entry;
+#endif
 
   VAR(uint8, AUTOMATIC) need_switch = NO_NEED_SWITCH;
 
@@ -793,8 +905,21 @@ FUNC(void, OS_CODE) tpl_schedule_from_running(CORE_ID_OR_VOID(core_id))
   tpl_check_stack((tpl_proc_id)TPL_KERN_REF(kern).elected_id);
 #endif /* WITH_STACK_MONITORING */
 
+#if WITH_EDF == YES
+  /*
+   * The ranks of the EDF band are deadlines compared modulo the range
+   * of the counter, so the keys are compared by tpl_compare_entries
+   */
+  elected_entry.key =
+    tpl_dyn_proc_table[TPL_KERN_REF(kern).elected_id]->priority;
+  elected_entry.id = (tpl_proc_id)TPL_KERN_REF(kern).elected_id;
+  if (tpl_compare_entries(&elected_entry,
+                          &READY_LIST(ready_list)[1]
+                          TAIL_FOR_PRIO_ARG(tail_for_prio)))
+#else
   if ((READY_LIST(ready_list)[1].key) >
       (tpl_dyn_proc_table[TPL_KERN_REF(kern).elected_id]->priority))
+#endif
         {
     /* Preempts the RUNNING task */
     tpl_preempt(CORE_ID_OR_NOTHING(core_id));
@@ -835,6 +960,8 @@ FUNC(void, OS_CODE) tpl_terminate(void)
    */
   CALL_POST_TASK_HOOK()
 
+  STATS_PROC_TERMINATE((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+
   /*
    * the task loses the CPU because it has been put in the WAITING or
    * in the DYING state, its internal resource is released.
@@ -911,7 +1038,8 @@ FUNC(void, OS_CODE) tpl_block(void)
   CALL_POST_TASK_HOOK()
 
   /* the task goes in the WAITING state */
-  TRACE_TASK_WAIT((tpl_proc_id)TPL_KERN_REF(kern).running_id)
+  TRACE_TASK_WAIT((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+  STATS_PROC_WAIT((tpl_proc_id)TPL_KERN_REF(kern).running_id);
   TPL_KERN_REF(kern).running->state = WAITING;
 
   /* The internal resource is released. */
@@ -958,8 +1086,6 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
   VAR(tpl_status, AUTOMATIC)                              result = E_OS_LIMIT;
   CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)           task =
     tpl_dyn_proc_table[task_id];
-  CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_task =
-    tpl_stat_proc_table[task_id];
 
   DOW_DO(printf("tpl_activate_task %s[%d](%d)\n",
     proc_name_table[task_id],
@@ -967,7 +1093,7 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
     task->priority
   ));
 
-  if (task->activate_count < s_task->max_activate_count)
+  if (task->activate_count < TPL_PROC_MAX_ACTIVATE_COUNT(task_id))
   {
 #if  WITH_AUTOSAR_TIMING_PROTECTION == YES
     /* a new instance is about to be activated: we need the agreement
@@ -975,13 +1101,15 @@ FUNC(tpl_status, OS_CODE) tpl_activate_task(
     if (tpl_tp_on_activate_or_release(task_id) == TRUE)
     {
 #endif  /* WITH_AUTOSAR_TIMING_PROTECTION */
+      STATS_PROC_ACTIVATE(task_id);
+
       if (task->activate_count == 0)
       {
         GET_PROC_CORE_ID(task_id, core_id)
 
         /*  the initialization is postponed to the time it will
             get the CPU as indicated by READY_AND_NEW state             */
-        TRACE_TASK_ACTIVATE(task_id)
+        TRACE_TASK_ACTIVATE(task_id);
 
         task->state = (tpl_proc_state)READY_AND_NEW;
 
@@ -1048,7 +1176,7 @@ FUNC(void, OS_CODE) tpl_release(CONST(tpl_task_id, AUTOMATIC) task_id)
 /**
  * @internal
  *
- * This function is used by SetEvent and by tpl_raise_alarm
+ * This function is used by SetEvent and by the expiry functions of alarms
  *
  * @param task_id           id of the task
  * @param incoming_event    Event mask
@@ -1085,7 +1213,7 @@ FUNC(tpl_status, OS_CODE) tpl_set_event(
         if (tpl_tp_on_activate_or_release(task_id) == TRUE)
         {
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-          TRACE_TASK_RELEASED(task_id,incoming_event)
+          TRACE_TASK_RELEASED(task_id,incoming_event);
           tpl_release(task_id);
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
         }
@@ -1175,6 +1303,11 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
   }
 #endif
 
+  /*  Start the buses and the time of the external communication */
+#if WITH_EXTERNAL_COM == YES
+  tpl_com_start_external();
+#endif
+
 #if TASK_COUNT > 0
   /*  Look for autostart tasks    */
   for (i = 0; i < TASK_COUNT; i++)
@@ -1184,7 +1317,7 @@ FUNC(void, OS_CODE) tpl_init_os(CONST(tpl_application_mode, AUTOMATIC) app_mode)
     {
 # if NUMBER_OF_CORES > 1
       /* In multicore, we must check if the task belongs to the core */
-      if (tpl_stat_proc_table[i]->core_id == core_id)
+      if (TPL_PROC_CORE_ID(i) == core_id)
 # endif
       {
         result = tpl_activate_task(i);
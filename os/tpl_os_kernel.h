@@ -162,6 +162,11 @@ typedef struct {
  * This is a data structure used to describe the static members of task
  * descriptors or category 2 Interrupt Service Routines. Static means this
  * part of the descriptor can be stored in ROM.
+ *
+ * When WITH_SOA_PROC_TABLES is YES, core_id, base_priority and
+ * max_activate_count are not in the structure but in the
+ * tpl_proc_core_id, tpl_proc_base_priority and tpl_proc_max_activate_count
+ * arrays. They are read with the TPL_PROC_* macros in both cases.
  */
 struct TPL_PROC_STATIC {
   VAR(tpl_context, TYPEDEF)
@@ -181,6 +186,7 @@ struct TPL_PROC_STATIC {
     app_id;             /**<  id of the OS application which owns
                               the task/ISR                                    */
 #endif
+#if WITH_SOA_PROC_TABLES == NO
 #if NUMBER_OF_CORES > 1
   CONST(tpl_core_id, TYPEDEF)
     core_id;            /**<  id of the core the process is assigned to      */
@@ -189,6 +195,7 @@ struct TPL_PROC_STATIC {
     base_priority;      /**<  base priority of the task/isr                  */
   CONST(tpl_activate_counter, TYPEDEF)
     max_activate_count; /**<  max activation count of a task/isr             */
+#endif
   CONST(tpl_proc_type, TYPEDEF)
     type;               /**<  type of the task/isr                           */
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
@@ -288,6 +295,47 @@ typedef struct {
   VAR(tpl_proc_id, TYPEDEF)   id;
 } tpl_heap_entry;
 
+#if NUMBER_OF_CORES > 1
+/**
+ * @typedef tpl_core_state
+ *
+ * Kernel state written by its own core only. goil puts it with the ready
+ * list of the core in a block of whole cache lines (TPL_CACHE_LINE_SIZE
+ * is given by the machine) so that two cores never write in the same
+ * cache line. The lock counters keep the names of the monocore variables
+ * so that GET_LOCK_CNT_FOR_CORE works in both cases.
+ */
+typedef struct
+{
+  VAR(tpl_kern_state, TYPEDEF)    kern;
+  volatile VAR(uint32, TYPEDEF)   tpl_locking_depth;
+  VAR(tpl_bool, TYPEDEF)          tpl_user_task_lock;
+  VAR(uint32, TYPEDEF)            tpl_cpt_user_task_lock_All;
+  VAR(uint32, TYPEDEF)            tpl_cpt_user_task_lock_OS;
+  VAR(uint32, TYPEDEF)            tpl_cpt_os_task_lock;
+} tpl_core_state;
+
+/*
+ * Defaults for the machines that do not give their cache line size
+ */
+#ifndef TPL_CACHE_LINE_SIZE
+#define TPL_CACHE_LINE_SIZE 64
+#endif
+#ifndef TPL_CACHE_LINE_ALIGNED
+#define TPL_CACHE_LINE_ALIGNED
+#endif
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+/**
+ * Table of the tpl_core_state of each core, indexed by the core identifier
+ */
+extern CONSTP2VAR(tpl_core_state, OS_CONST, OS_VAR)
+  tpl_core_state_table[NUMBER_OF_CORES];
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+#endif
+
 
 #define OS_START_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
@@ -481,6 +529,32 @@ extern VAR(tpl_rank_count, OS_VAR) tpl_tail_for_prio[];
 
 #endif
 
+#if WITH_EDF == YES
+
+struct TPL_COUNTER;
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+/**
+ * @internal
+ *
+ * Relative deadline of each task. It is used for the tasks of the
+ * EDF_PRIORITY level only.
+ */
+extern CONST(tpl_tick, OS_CONST) tpl_edf_deadline[TASK_COUNT];
+
+/**
+ * @internal
+ *
+ * The counter that gives the activation date of the EDF jobs
+ * (the SystemCounter).
+ */
+extern CONSTP2VAR(struct TPL_COUNTER, OS_CONST, OS_VAR) tpl_edf_counter;
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#endif
+
 #define OS_START_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 /**
@@ -497,9 +571,50 @@ extern CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)
 extern CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
   tpl_dyn_proc_table[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
 
+#if WITH_SOA_PROC_TABLES == YES
+/**
+ * Fields of the static descriptors read by the scheduling, one array per
+ * field indexed by the process id, idle tasks included.
+ */
+extern CONST(tpl_priority, OS_CONST)
+  tpl_proc_base_priority[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
+
+extern CONST(tpl_activate_counter, OS_CONST)
+  tpl_proc_max_activate_count[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
+
+#if NUMBER_OF_CORES > 1
+extern CONST(tpl_core_id, OS_CONST)
+  tpl_proc_core_id[TASK_COUNT+ISR_COUNT+NUMBER_OF_CORES];
+#endif
+#endif
+
 #define OS_STOP_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
+/**
+ * @def TPL_PROC_BASE_PRIORITY
+ * @def TPL_PROC_MAX_ACTIVATE_COUNT
+ * @def TPL_PROC_CORE_ID
+ *
+ * Static fields of process proc_id, from the arrays or from the static
+ * descriptor depending on WITH_SOA_PROC_TABLES.
+ */
+#if WITH_SOA_PROC_TABLES == YES
+#define TPL_PROC_BASE_PRIORITY(proc_id)                                 \
+  (tpl_proc_base_priority[proc_id])
+#define TPL_PROC_MAX_ACTIVATE_COUNT(proc_id)                            \
+  (tpl_proc_max_activate_count[proc_id])
+#define TPL_PROC_CORE_ID(proc_id)                                       \
+  (tpl_proc_core_id[proc_id])
+#else
+#define TPL_PROC_BASE_PRIORITY(proc_id)                                 \
+  (tpl_stat_proc_table[proc_id]->base_priority)
+#define TPL_PROC_MAX_ACTIVATE_COUNT(proc_id)                            \
+  (tpl_stat_proc_table[proc_id]->max_activate_count)
+#define TPL_PROC_CORE_ID(proc_id)                                       \
+  (tpl_stat_proc_table[proc_id]->core_id)
+#endif
+
 
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
@@ -569,6 +684,14 @@ FUNC(void, OS_CODE) tpl_put_preempted_proc(
 FUNC(void, OS_CODE) tpl_put_new_proc(
   CONST(tpl_proc_id, AUTOMATIC) proc_id);
 
+FUNC(void, OS_CODE) tpl_raise_preempted_proc(
+  CONST(tpl_proc_id, AUTOMATIC)   proc_id,
+  CONST(tpl_priority, AUTOMATIC)  prio);
+
+FUNC(void, OS_CODE) tpl_lower_preempted_proc(
+  CONST(tpl_proc_id, AUTOMATIC)   proc_id,
+  CONST(tpl_priority, AUTOMATIC)  dyn_prio);
+
 FUNC(void, OS_CODE) tpl_init_os(
   CONST(tpl_application_mode, AUTOMATIC) app_mode);
 
@@ -0,0 +1,126 @@
+/**
+ * @file tpl_os_latency_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline interrupt and alarm latency histograms
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_latency_kernel.h"
+#include "tpl_os_stats_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_machine_interface.h"
+
+#if WITH_LATENCY == YES
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if ISR_COUNT > 0
+VAR(tpl_latency_histogram, OS_VAR) tpl_isr_latency[ISR_COUNT];
+#endif
+
+#if ALARM_COUNT > 0
+VAR(tpl_latency_histogram, OS_VAR) tpl_alarm_latency[ALARM_COUNT];
+#endif
+
+VAR(tpl_stats_time, OS_VAR) tpl_latency_irq_date[NUMBER_OF_CORES];
+
+VAR(uint32, OS_VAR) tpl_latency_alarm[NUMBER_OF_CORES];
+VAR(tpl_stats_time, OS_VAR) tpl_latency_alarm_date[NUMBER_OF_CORES];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+FUNC(void, OS_CODE) tpl_latency_record(
+  P2VAR(uint32, AUTOMATIC, OS_VAR)  histogram,
+  CONST(tpl_stats_time, AUTOMATIC)  latency)
+{
+  VAR(tpl_stats_time, AUTOMATIC) rest = latency;
+  VAR(uint32, AUTOMATIC) bucket = 0;
+
+  /* bucket is the number of significant bits of the latency */
+  while ((rest != 0) && (bucket < (TPL_LATENCY_BUCKETS - 1)))
+  {
+    rest >>= 1;
+    bucket++;
+  }
+  histogram[bucket]++;
+}
+
+FUNC(void, OS_CODE) tpl_latency_irq_entry(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  tpl_latency_irq_date[LATENCY_CORE(core_id)] = TPL_STATS_TIMER();
+}
+
+FUNC(void, OS_CODE) tpl_latency_alarm_begin(
+  CONSTP2CONST(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  tpl_latency_alarm[LATENCY_CORE(core_id)] =
+    (uint32)time_obj->stat_part->timeobj_id + 1;
+  tpl_latency_alarm_date[LATENCY_CORE(core_id)] = TPL_STATS_TIMER();
+}
+
+FUNC(void, OS_CODE) tpl_latency_alarm_end(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  tpl_latency_alarm[LATENCY_CORE(core_id)] = 0;
+}
+
+FUNC(tpl_status, OS_CODE) tpl_dump_latency_service(void)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_DumpLatency)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_dump_latency();
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_LATENCY */
+
+/* End of file tpl_os_latency_kernel.c */
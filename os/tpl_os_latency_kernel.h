@@ -0,0 +1,161 @@
+/**
+ * @file tpl_os_latency_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline interrupt and alarm latency histograms header
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_LATENCY_KERNEL_H
+#define TPL_OS_LATENCY_KERNEL_H
+
+#include "tpl_os_internal_types.h"
+#include "tpl_os_timeobj_kernel.h"
+
+#if WITH_LATENCY == YES
+
+/**
+ * @def TPL_LATENCY_BUCKETS
+ *
+ * Bucket 0 counts the null latencies and bucket b > 0 the latencies from
+ * 2^(b-1) to 2^b - 1 in the unit of the statistics timer. The last bucket
+ * also counts the longer ones.
+ */
+#define TPL_LATENCY_BUCKETS 32
+
+/**
+ * @typedef tpl_latency_histogram
+ *
+ * Latencies of an interrupt or of an alarm
+ */
+typedef uint32 tpl_latency_histogram[TPL_LATENCY_BUCKETS];
+
+#if NUMBER_OF_CORES > 1
+# define LATENCY_CORE(a_core_id)  (a_core_id)
+#else
+# define LATENCY_CORE(a_core_id)  0
+#endif
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if ISR_COUNT > 0
+/**
+ * Latencies from the entry in tpl_central_interrupt_handler to the start
+ * of the ISR2, indexed by the ISR2 id minus TASK_COUNT
+ */
+extern VAR(tpl_latency_histogram, OS_VAR) tpl_isr_latency[ISR_COUNT];
+#endif
+
+#if ALARM_COUNT > 0
+/**
+ * Latencies from the expiry of an alarm to the start
+ * of the task it activates, indexed by the alarm id
+ */
+extern VAR(tpl_latency_histogram, OS_VAR) tpl_alarm_latency[ALARM_COUNT];
+#endif
+
+/**
+ * Date of the last entry in the central interrupt handler of each core
+ */
+extern VAR(tpl_stats_time, OS_VAR) tpl_latency_irq_date[NUMBER_OF_CORES];
+
+/**
+ * Alarm being raised on each core, plus 1, or 0 when no alarm is raised,
+ * and the date it began
+ */
+extern VAR(uint32, OS_VAR) tpl_latency_alarm[NUMBER_OF_CORES];
+extern VAR(tpl_stats_time, OS_VAR) tpl_latency_alarm_date[NUMBER_OF_CORES];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if ALARM_COUNT > 0
+/**
+ * Names of the alarms for the dump, generated by goil
+ */
+extern CONSTP2CONST(char, AUTOMATIC, OS_APPL_DATA)
+  tpl_alarm_name_table[ALARM_COUNT];
+#endif
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Counts a latency in a histogram
+ */
+extern FUNC(void, OS_CODE) tpl_latency_record(
+  P2VAR(uint32, AUTOMATIC, OS_VAR)  histogram,
+  CONST(tpl_stats_time, AUTOMATIC)  latency);
+
+/**
+ * @internal
+ *
+ * Dates the entry in the central interrupt handler
+ */
+extern FUNC(void, OS_CODE) tpl_latency_irq_entry(void);
+
+/**
+ * @internal
+ *
+ * The tasks activated until #tpl_latency_alarm_end are activated by the
+ * alarm time_obj. Called by the expiry function of the alarm.
+ */
+extern FUNC(void, OS_CODE) tpl_latency_alarm_begin(
+  CONSTP2CONST(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj);
+
+extern FUNC(void, OS_CODE) tpl_latency_alarm_end(void);
+
+/**
+ * @internal
+ *
+ * Service DumpLatency: hands the histograms to the machine
+ * (see #tpl_dump_latency).
+ *
+ * @retval  E_OK    no error
+ */
+extern FUNC(tpl_status, OS_CODE) tpl_dump_latency_service(void);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#  define STATS_IRQ_ENTRY()             do { tpl_latency_irq_entry(); } while (0)
+#  define STATS_ALARM_BEGIN(time_obj)   do { tpl_latency_alarm_begin(time_obj); } while (0)
+#  define STATS_ALARM_END()             do { tpl_latency_alarm_end(); } while (0)
+
+#else
+
+#  define STATS_IRQ_ENTRY()             do { } while (0)
+#  define STATS_ALARM_BEGIN(time_obj)   do { } while (0)
+#  define STATS_ALARM_END()             do { } while (0)
+
+#endif /* WITH_LATENCY */
+
+#endif /* TPL_OS_LATENCY_KERNEL_H */
+
+/* End of file tpl_os_latency_kernel.h */
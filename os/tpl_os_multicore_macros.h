@@ -40,7 +40,7 @@
  * the proc passed as argument.
  */
 #define GET_PROC_CORE_ID(a_proc_id, a_core_id) \
-  CONST(uint16, AUTOMATIC) a_core_id = tpl_stat_proc_table[a_proc_id]->core_id;
+  CONST(uint16, AUTOMATIC) a_core_id = TPL_PROC_CORE_ID(a_proc_id);
 /*
  * GET_CURRENT_CORE_ID initializes the constant core_id
  * with the current core_id
@@ -116,10 +116,12 @@
   , a_tail_for_prio
 
 /*
- * GET_LOCK_CNT_FOR_CORE expands to the corresponding array in multicore.
+ * GET_LOCK_CNT_FOR_CORE expands to the corresponding member of the
+ * tpl_core_state of the core in multicore.
  * It is used to retrieve all lock counters (e.g. tpl_locking_depth)
  */
-#define GET_LOCK_CNT_FOR_CORE(a_lock_cnt, a_core_id)  a_lock_cnt[a_core_id]
+#define GET_LOCK_CNT_FOR_CORE(a_lock_cnt, a_core_id)  \
+  (tpl_core_state_table[a_core_id]->a_lock_cnt)
 
 #else
 /*
@@ -133,7 +133,7 @@ FUNC(void, OS_CODE) tpl_start_os_service(
     application_mode = mode;
 #endif
 
-    TRACE_TPL_INIT()
+    TRACE_TPL_INIT();
 
     tpl_init_os(mode);
 
@@ -187,7 +187,7 @@ FUNC(void, OS_CODE) tpl_call_shutdown_os(
   RELEASE_ALL_SPINLOCKS(core_id);
 #endif
 
-  TRACE_TPL_TERMINATE()
+  TRACE_TPL_TERMINATE();
 
   /* architecture dependant shutdown. */
   tpl_shutdown();
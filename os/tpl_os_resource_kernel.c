@@ -109,7 +109,7 @@ FUNC(void, OS_CODE) tpl_release_all_resources(
 	  while( TPL_RESOURCE_TABLE(core_id)[res_id] != res ){
 		  res_id++;
 	  }
-	  TRACE_RES_RELEASED(res_id)
+	  TRACE_RES_RELEASED(res_id);
 #endif /* WITH_TRACE */
 
 	  res = next_res;
@@ -117,6 +117,65 @@ FUNC(void, OS_CODE) tpl_release_all_resources(
   }
 }
 
+#if RESOURCE_COUNT > 0
+/*
+ * Takes the resource res_id for the running process, the kernel being
+ * locked. Used by the GetResource services once the id is known to be
+ * valid.
+ */
+STATIC FUNC(tpl_status, OS_CODE) tpl_get_resource(
+    CONST(tpl_resource_id, AUTOMATIC) res_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  CONSTP2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res =
+    TPL_RESOURCE_TABLE(core_id)[res_id];
+
+  /*  Return an error if the task that attempt to get
+      the resource has a higher priority than the resource
+      or the resource is already owned by another task
+      By using PCP, this situation should no occur.         */
+  CHECK_RESOURCE_PRIO_ERROR_ON_GET(core_id, res, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /*  set the owner of the resource to the calling task     */
+    res->owner = (tpl_proc_id)TPL_KERN_REF(kern).running_id;
+    TRACE_RES_GET(res_id, (tpl_proc_id)TPL_KERN_REF(kern).running_id);
+    /*  add the ressource at the beginning of the
+        resource list stored in the task descriptor              */
+    res->next_res = TPL_KERN_REF(kern).running->resources;
+    TPL_KERN_REF(kern).running->resources = res;
+    /*  save the current priority of the task in the resource */
+    res->owner_prev_priority = TPL_KERN_REF(kern).running->priority;
+
+   DOW_DO(printf("*** GetResource: task %s stores priority %d\n",
+                 proc_name_table[TPL_KERN_REF(kern).running_id],
+                 TPL_KERN_REF(kern).running->priority));
+
+    if (ACTUAL_PRIO(TPL_KERN_REF(kern).running->priority) <
+        res->ceiling_priority)
+    {
+      GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+      /*  set the task priority at the ceiling priority of the resource
+          if the ceiling priority is greater than the current priority of
+          the task  */
+      TPL_KERN_REF(kern).running->priority =
+        DYNAMIC_PRIO(res->ceiling_priority, tail_for_prio);
+      TRACE_TASK_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+      TRACE_ISR_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN_REF(kern).running_id);
+    }
+#if WITH_AUTOSAR_TIMING_PROTECTION == YES
+/*    tpl_start_resource_monitor((tpl_proc_id)TPL_KERN_REF(kern).running_id, res_id); */
+#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+  }
+
+  return result;
+}
+#endif
+
 /*
  * Getting a resource.
  *
@@ -128,15 +187,10 @@ FUNC(tpl_status, OS_CODE) tpl_get_resource_service(
     CONST(tpl_resource_id, AUTOMATIC) res_id)
 {
   GET_CURRENT_CORE_ID(core_id)
-  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
 
   /*  init the error to no error  */
   VAR(tpl_status, AUTOMATIC) result = E_OK;
 
-#if RESOURCE_COUNT > 0
-  P2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res;
-#endif
-
   LOCK_KERNEL()
 
   /* check interrupts are not disabled by user    */
@@ -150,53 +204,48 @@ FUNC(tpl_status, OS_CODE) tpl_get_resource_service(
   /* check access right */
   CHECK_ACCESS_RIGHTS_RESOURCE_ID(core_id, res_id, result)
 
+#if RESOURCE_COUNT > 0
   IF_NO_EXTENDED_ERROR(result)
   {
-#if RESOURCE_COUNT > 0
-    res = TPL_RESOURCE_TABLE(core_id)[res_id];
-#else
-    res = NULL; /* error */
+    result = tpl_get_resource(res_id);
+  }
 #endif
 
-    /*  Return an error if the task that attempt to get
-        the resource has a higher priority than the resource
-        or the resource is already owned by another task
-        By using PCP, this situation should no occur.         */
-    CHECK_RESOURCE_PRIO_ERROR_ON_GET(core_id, res, result)
+  PROCESS_ERROR(result)
 
-    IF_NO_EXTENDED_ERROR(result)
-    {
-      /*  set the owner of the resource to the calling task     */
-      res->owner = (tpl_proc_id)TPL_KERN_REF(kern).running_id;
-      TRACE_RES_GET(res_id, (tpl_proc_id)TPL_KERN_REF(kern).running_id)
-      /*  add the ressource at the beginning of the
-          resource list stored in the task descriptor              */
-      res->next_res = TPL_KERN_REF(kern).running->resources;
-      TPL_KERN_REF(kern).running->resources = res;
-      /*  save the current priority of the task in the resource */
-      res->owner_prev_priority = TPL_KERN_REF(kern).running->priority;
-
-     DOW_DO(printf("*** GetResource: task %s stores priority %d\n",
-                   proc_name_table[TPL_KERN_REF(kern).running_id],
-                   TPL_KERN_REF(kern).running->priority));
-
-      if (ACTUAL_PRIO(TPL_KERN_REF(kern).running->priority) <
-          res->ceiling_priority)
-      {
-        GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
-        /*  set the task priority at the ceiling priority of the resource
-            if the ceiling priority is greater than the current priority of
-            the task  */
-        TPL_KERN_REF(kern).running->priority =
-          DYNAMIC_PRIO(res->ceiling_priority, tail_for_prio);
-        TRACE_TASK_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN_REF(kern).running_id)
-        TRACE_ISR_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN_REF(kern).running_id)
-      }
-#if WITH_AUTOSAR_TIMING_PROTECTION == YES
-/*    tpl_start_resource_monitor((tpl_proc_id)TPL_KERN_REF(kern).running_id, res_id); */
-#endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-    }
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+/*
+ * GetResource_<resource>: the resource id is a constant of the OIL file,
+ * there is no id check.
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_resource_static_service(
+    CONST(tpl_resource_id, AUTOMATIC) res_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetResource)
+  STORE_RESOURCE_ID(res_id)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_RESOURCE_ID(core_id, res_id, result)
+
+#if RESOURCE_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_get_resource(res_id);
   }
+#endif
 
   PROCESS_ERROR(result)
 
@@ -265,14 +314,14 @@ FUNC(tpl_status, OS_CODE) tpl_release_resource_service(
              proc_name_table[TPL_KERN(core_id).running_id],
              TPL_KERN(core_id).running->priority));
 
-      TRACE_TASK_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN(core_id).running_id)
-      TRACE_ISR_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN(core_id).running_id)
+      TRACE_TASK_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN(core_id).running_id);
+      TRACE_ISR_CHANGE_PRIORITY((tpl_proc_id)TPL_KERN(core_id).running_id);
       /*  remove the resource from the resource list  */
       TPL_KERN(core_id).running->resources = res->next_res;
       res->next_res = NULL;
       /*  remove the owner    */
       res->owner = INVALID_TASK;
-      TRACE_RES_RELEASED(res_id)
+      TRACE_RES_RELEASED(res_id);
       tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
 # if WITH_AUTOSAR_TIMING_PROTECTION == YES
 /*    tpl_stop_resource_monitor((tpl_proc_id)TPL_KERN(core_id).running_id, res_id); */
@@ -112,6 +112,15 @@ FUNC(void, OS_CODE) tpl_release_all_resources(
 FUNC(tpl_status, OS_CODE) tpl_get_resource_service(
   CONST(tpl_resource_id, AUTOMATIC) res_id);
 
+/**
+ * Getting a resource whose identifier is a constant of the OIL file.
+ *
+ * It is called by the GetResource_<resource> macros goil generates in
+ * tpl_os.h. Since res_id is valid by construction, it is not checked.
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_resource_static_service(
+  CONST(tpl_resource_id, AUTOMATIC) res_id);
+
 
 /**
  * Releasing a resource
@@ -25,23 +25,58 @@
 
 #include "tpl_os_semaphore_kernel.h"
 #include "tpl_os_kernel.h"
+#include "tpl_os_resource_kernel.h"
 #include "tpl_os_definitions.h"
 #include "tpl_os_error.h"
 #include "tpl_machine_interface.h"
 
+/*
+ * tpl_sem_enqueue
+ *
+ * Puts a task in the wait queue of a semaphore. With the priority queuing,
+ * the task is put before the waiting tasks of lower priority.
+ */
 FUNC(void, OS_CODE) tpl_sem_enqueue(
   P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem,
   CONST(tpl_task_id, AUTOMATIC)                 task_id)
 {
+  VAR(uint32, AUTOMATIC) pos = sem->index;
+  VAR(uint32, AUTOMATIC) prev;
+  VAR(uint32, AUTOMATIC) count = sem->size;
+  CONST(tpl_priority, AUTOMATIC) prio =
+    ACTUAL_PRIO(tpl_dyn_proc_table[task_id]->priority);
+
+  if (sem->queuing == TPL_SEM_PRIORITY_QUEUING)
+  {
+    /* the lower priority tasks go back one place */
+    while (count > 0)
+    {
+      prev = (pos == 0) ? (sem->capacity - 1) : (pos - 1);
+      if (ACTUAL_PRIO(tpl_dyn_proc_table[sem->waiting_tasks[prev]]->priority)
+          >= prio)
+      {
+        break;
+      }
+      sem->waiting_tasks[pos] = sem->waiting_tasks[prev];
+      pos = prev;
+      count--;
+    }
+  }
+
   sem->size++;
-  sem->waiting_tasks[sem->index] = task_id;
+  sem->waiting_tasks[pos] = task_id;
   sem->index++;
-  if (sem->index == TASK_COUNT)
+  if (sem->index == sem->capacity)
   {
     sem->index = 0;
   }
 }
 
+/*
+ * tpl_sem_dequeue
+ *
+ * Removes the first task of the wait queue of a semaphore and releases it
+ */
 FUNC(tpl_task_id, OS_CODE) tpl_sem_dequeue(
   P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem)
 {
@@ -50,7 +85,7 @@ FUNC(tpl_task_id, OS_CODE) tpl_sem_dequeue(
 
   if (sem->index < sem->size)
   {
-    read_index += TASK_COUNT;
+    read_index += sem->capacity;
   }
   task_id = sem->waiting_tasks[read_index];
   sem->size--;
@@ -61,6 +96,40 @@ FUNC(tpl_task_id, OS_CODE) tpl_sem_dequeue(
   return task_id;
 }
 
+/*
+ * tpl_sem_restore_holder
+ *
+ * Gives back to the boosted holder of a semaphore the priority it had
+ * before it inherited one. If the holder took resources meanwhile, it
+ * keeps the highest of their ceilings.
+ */
+STATIC FUNC(void, OS_CODE) tpl_sem_restore_holder(
+  P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem)
+{
+  GET_PROC_CORE_ID(sem->holder, core_id)
+  GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+  P2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res =
+    tpl_dyn_proc_table[sem->holder]->resources;
+  VAR(tpl_priority, AUTOMATIC) prio = sem->holder_prev_priority;
+  VAR(tpl_priority, AUTOMATIC) ceiling = ACTUAL_PRIO(prio);
+
+  while (res != NULL)
+  {
+    if (res->ceiling_priority > ceiling)
+    {
+      ceiling = res->ceiling_priority;
+    }
+    res = res->next_res;
+  }
+  if (ceiling > ACTUAL_PRIO(prio))
+  {
+    prio = DYNAMIC_PRIO(ceiling, tail_for_prio);
+  }
+
+  tpl_lower_preempted_proc(sem->holder, prio);
+  sem->boosted = FALSE;
+}
+
 #if WITH_DOW == YES
 #include <stdio.h>
 #include "tpl_app_config.h"
@@ -73,7 +142,7 @@ FUNC(void, OS_CODE) tpl_sem_print(CONST(SemType, AUTOMATIC) sem_id)
   printf("(%lu)", sem->token);
   if (sem->index < sem->size)
   {
-    index += TASK_COUNT;
+    index += sem->capacity;
   }
 
   if (sem->size > 0)
@@ -83,7 +152,7 @@ FUNC(void, OS_CODE) tpl_sem_print(CONST(SemType, AUTOMATIC) sem_id)
     {
       printf(" %s", proc_name_table[sem->waiting_tasks[index]]);
       index++;
-      if (index == TASK_COUNT) index = 0;
+      if (index == sem->capacity) index = 0;
       count--;
     }
   }
@@ -101,17 +170,29 @@ FUNC(tpl_status, OS_CODE) tpl_sem_wait_service(CONST(SemType, AUTOMATIC) sem_id)
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   VAR(tpl_task_id, AUTOMATIC) task_id;
-  P2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_task;
   CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem = tpl_sem_table[sem_id];
 
   LOCK_KERNEL()
 
   task_id = TPL_KERN_REF(kern).running_id;
-  s_task = tpl_stat_proc_table[task_id];
-  if (s_task->max_activate_count == 1)
+  if (TPL_PROC_MAX_ACTIVATE_COUNT(task_id) == 1)
   {
     if (sem->token == 0)
     {
+      if ((sem->inheritance == TRUE) && (sem->holder != INVALID_PROC_ID))
+      {
+        /* the holder inherits the priority of the blocked task */
+        if (sem->boosted == FALSE)
+        {
+          sem->holder_prev_priority =
+            tpl_dyn_proc_table[sem->holder]->priority;
+        }
+        tpl_raise_preempted_proc(
+          sem->holder,
+          ACTUAL_PRIO(TPL_KERN_REF(kern).running->priority));
+        sem->boosted = (tpl_bool)(tpl_dyn_proc_table[sem->holder]->priority !=
+                                  sem->holder_prev_priority);
+      }
       tpl_sem_enqueue(sem, task_id);
       /* block the running task */
       tpl_block();
@@ -119,6 +200,7 @@ FUNC(tpl_status, OS_CODE) tpl_sem_wait_service(CONST(SemType, AUTOMATIC) sem_id)
     else
     {
       sem->token--;
+      sem->holder = task_id;
     }
   }
   else
@@ -135,31 +217,38 @@ FUNC(tpl_status, OS_CODE) tpl_sem_post_service(CONST(SemType, AUTOMATIC) sem_id)
 {
   GET_CURRENT_CORE_ID(core_id)
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
-  VAR(tpl_task_id, AUTOMATIC) task_id;
   CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem = tpl_sem_table[sem_id];
 
   LOCK_KERNEL()
 
-  if (sem->size > 0)
+  if (sem->boosted == TRUE)
   {
-    task_id = tpl_sem_dequeue(sem);
-    /* release the task */
-    tpl_release(task_id);
-    if (TPL_KERN_REF(kern).need_schedule)
+    /* the holder gets back its priority, whoever posts */
+    tpl_sem_restore_holder(sem);
+    if (sem->holder == TPL_KERN_REF(kern).running_id)
     {
-      tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
-      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(core_id))
+      TPL_KERN_REF(kern).need_schedule = TRUE;
     }
   }
+
+  if (sem->size > 0)
+  {
+    /* the released task takes the token */
+    sem->holder = tpl_sem_dequeue(sem);
+  }
   else
   {
     sem->token++;
+    sem->holder = INVALID_PROC_ID;
+  }
+
+  if (TPL_KERN_REF(kern).need_schedule)
+  {
+    tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
+    SWITCH_CONTEXT(CORE_ID_OR_NOTHING(core_id))
   }
 
   UNLOCK_KERNEL()
 
   return E_OK;
 }
-
-
-
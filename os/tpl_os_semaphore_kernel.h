@@ -27,13 +27,50 @@
 #define TPL_OS_SEMAPHORE_KERNEL_H
 
 #include "tpl_os_types.h"
+#include "tpl_os_internal_types.h"
 #include "tpl_os_semaphore.h"
 
+/**
+ * @def TPL_SEM_FIFO_QUEUING
+ *
+ * The waiting tasks are released in the order they called SemWait
+ */
+#define TPL_SEM_FIFO_QUEUING      0
+
+/**
+ * @def TPL_SEM_PRIORITY_QUEUING
+ *
+ * The highest priority waiting task is released first. Tasks of the
+ * same priority are released in the order they called SemWait
+ */
+#define TPL_SEM_PRIORITY_QUEUING  1
+
+/**
+ * @typedef tpl_semaphore
+ *
+ * waiting_tasks is a ring of capacity entries where size tasks wait, the
+ * next one being stored at index. goil sizes it with the number of tasks
+ * that access the semaphore.
+ *
+ * When inheritance is TRUE, holder is the task that took the last token.
+ * A task that blocks on the semaphore gives its priority to the holder
+ * if the holder is READY with a lower priority. The holder gets back
+ * holder_prev_priority, or the highest ceiling of the resources it took
+ * meanwhile, at the next post of the semaphore, by the holder or by any
+ * other task. boosted is cleared before the token is handed to the next
+ * holder.
+ */
 typedef struct {
-  uint32      token;
-  uint32      size;
-  uint32      index;
-  tpl_task_id waiting_tasks[TASK_COUNT];
+  uint32                              token;
+  uint32                              size;
+  uint32                              index;
+  uint32                              capacity;
+  P2VAR(tpl_task_id, TYPEDEF, OS_VAR) waiting_tasks;
+  uint8                               queuing;
+  tpl_bool                            inheritance;
+  tpl_bool                            boosted;
+  tpl_proc_id                         holder;
+  tpl_priority                        holder_prev_priority;
 } tpl_semaphore;
 
 extern CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) tpl_sem_table[];
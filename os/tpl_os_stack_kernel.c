@@ -0,0 +1,66 @@
+/**
+ * @file tpl_os_stack_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline stack usage report
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_stack_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_machine_interface.h"
+
+#if WITH_STACK_REPORT == YES
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+FUNC(tpl_status, OS_CODE) tpl_dump_stack_usage_service(void)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_DumpStackUsage)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_dump_stack_usage();
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_STACK_REPORT */
+
+/* End of file tpl_os_stack_kernel.c */
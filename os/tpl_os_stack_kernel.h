@@ -0,0 +1,53 @@
+/**
+ * @file tpl_os_stack_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline stack usage report header
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_STACK_KERNEL_H
+#define TPL_OS_STACK_KERNEL_H
+
+#include "tpl_os_internal_types.h"
+
+#if WITH_STACK_REPORT == YES
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Service DumpStackUsage: hands the peak stack usage of the tasks and
+ * ISR2 to the machine (see #tpl_dump_stack_usage).
+ *
+ * @retval  E_OK    no error
+ */
+extern FUNC(tpl_status, OS_CODE) tpl_dump_stack_usage_service(void);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_STACK_REPORT */
+
+#endif /* TPL_OS_STACK_KERNEL_H */
+
+/* End of file tpl_os_stack_kernel.h */
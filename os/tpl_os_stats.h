@@ -0,0 +1,67 @@
+/**
+ * @file tpl_os_stats.h
+ *
+ * @section desc File description
+ *
+ * Trampoline runtime statistics types header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_STATS_H
+#define TPL_OS_STATS_H
+
+#include "tpl_os_std_types.h"
+#include "tpl_os_custom_types.h"
+
+/**
+ * @typedef tpl_proc_stats
+ *
+ * Runtime statistics of a task or of an ISR2. Durations are in the unit
+ * of the statistics timer.
+ *
+ * - activations is the number of accepted activations;
+ * - jobs is the number of terminated jobs;
+ * - preemptions is the number of times the process lost the CPU while
+ *   READY;
+ * - exec_min and exec_max are the extreme execution times of a job and
+ *   exec_sum is the total execution time;
+ * - response_min, response_max and response_sum are the times from the
+ *   activation to the termination of the jobs.
+ *
+ * The sums wrap around when they overflow tpl_stats_time.
+ */
+typedef struct {
+  uint32          activations;
+  uint32          jobs;
+  uint32          preemptions;
+  tpl_stats_time  exec_min;
+  tpl_stats_time  exec_max;
+  tpl_stats_time  exec_sum;
+  tpl_stats_time  response_min;
+  tpl_stats_time  response_max;
+  tpl_stats_time  response_sum;
+} tpl_proc_stats;
+
+typedef tpl_proc_stats ProcStatsType;
+
+typedef P2VAR(tpl_proc_stats, TYPEDEF, OS_APPL_DATA) ProcStatsRefType;
+
+#endif /* TPL_OS_STATS_H */
+
+/* End of file tpl_os_stats.h */
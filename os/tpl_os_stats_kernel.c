@@ -0,0 +1,235 @@
+/**
+ * @file tpl_os_stats_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline runtime statistics of the tasks and ISR2
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os_stats_kernel.h"
+#include "tpl_os_latency_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_machine_interface.h"
+
+#if WITH_STATS == YES
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+VAR(tpl_proc_stats_state, OS_VAR) tpl_proc_stats_table[TPL_STATS_PROC_COUNT];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * The running id is INVALID_PROC_ID before the first process runs. It
+ * gives a huge index once converted and is filtered out here.
+ */
+#define IS_STATS_PROC(proc_id) ((uint32)(proc_id) < TPL_STATS_PROC_COUNT)
+
+/*
+ * tpl_stats_end_slice
+ *
+ * Adds the time proc_id has run since it got the CPU to its current job
+ */
+STATIC FUNC(void, OS_CODE) tpl_stats_end_slice(
+  P2VAR(tpl_proc_stats_state, AUTOMATIC, OS_VAR)  state,
+  CONST(tpl_stats_time, AUTOMATIC)                now)
+{
+  CONST(tpl_stats_time, AUTOMATIC) slice = now - state->slice_start;
+
+  state->job_exec += slice;
+  state->counters.exec_sum += slice;
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_activate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2VAR(tpl_proc_stats_state, AUTOMATIC, OS_VAR) state =
+    &tpl_proc_stats_table[proc_id];
+
+  state->counters.activations++;
+  /*
+   * The response time of a job starts at its activation. Queued
+   * activations keep no date, the job that follows a termination is
+   * considered released at this termination. This is called before the
+   * activation changes the state, so a task that chains to itself,
+   * whose activate_count is already 0 but which is still RUNNING, keeps
+   * the release date of its current job.
+   */
+  if (tpl_dyn_proc_table[proc_id]->state == (tpl_proc_state)SUSPENDED)
+  {
+#if WITH_LATENCY == YES
+    GET_CURRENT_CORE_ID(core_id)
+
+    state->latency = NULL;
+#if ISR_COUNT > 0
+    /* an ISR2 is released when its interrupt enters the kernel */
+    if (((uint32)proc_id >= TASK_COUNT) &&
+        ((uint32)proc_id < (TASK_COUNT + ISR_COUNT)))
+    {
+      state->release = tpl_latency_irq_date[LATENCY_CORE(core_id)];
+      state->latency = tpl_isr_latency[proc_id - TASK_COUNT];
+    }
+    else
+#endif
+#if ALARM_COUNT > 0
+    /* a task activated by an alarm is released when the alarm expires */
+    if (tpl_latency_alarm[LATENCY_CORE(core_id)] != 0)
+    {
+      state->release = tpl_latency_alarm_date[LATENCY_CORE(core_id)];
+      state->latency =
+        tpl_alarm_latency[tpl_latency_alarm[LATENCY_CORE(core_id)] - 1];
+    }
+    else
+#endif
+#endif /* WITH_LATENCY */
+    {
+      state->release = TPL_STATS_TIMER();
+    }
+  }
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_run(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  if (IS_STATS_PROC(proc_id))
+  {
+    CONSTP2VAR(tpl_proc_stats_state, AUTOMATIC, OS_VAR) state =
+      &tpl_proc_stats_table[proc_id];
+
+    state->slice_start = TPL_STATS_TIMER();
+#if WITH_LATENCY == YES
+    if (state->latency != NULL)
+    {
+      tpl_latency_record(state->latency,
+                         state->slice_start - state->release);
+      state->latency = NULL;
+    }
+#endif
+  }
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_preempt(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  if (IS_STATS_PROC(proc_id))
+  {
+    CONSTP2VAR(tpl_proc_stats_state, AUTOMATIC, OS_VAR) state =
+      &tpl_proc_stats_table[proc_id];
+
+    tpl_stats_end_slice(state, TPL_STATS_TIMER());
+    state->counters.preemptions++;
+  }
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_wait(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  tpl_stats_end_slice(&tpl_proc_stats_table[proc_id], TPL_STATS_TIMER());
+}
+
+FUNC(void, OS_CODE) tpl_stats_on_terminate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2VAR(tpl_proc_stats_state, AUTOMATIC, OS_VAR) state =
+    &tpl_proc_stats_table[proc_id];
+  CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_VAR) counters = &state->counters;
+  CONST(tpl_stats_time, AUTOMATIC) now = TPL_STATS_TIMER();
+  VAR(tpl_stats_time, AUTOMATIC) response;
+
+  tpl_stats_end_slice(state, now);
+  response = now - state->release;
+
+  if ((counters->jobs == 0) || (state->job_exec < counters->exec_min))
+  {
+    counters->exec_min = state->job_exec;
+  }
+  if (state->job_exec > counters->exec_max)
+  {
+    counters->exec_max = state->job_exec;
+  }
+  if ((counters->jobs == 0) || (response < counters->response_min))
+  {
+    counters->response_min = response;
+  }
+  if (response > counters->response_max)
+  {
+    counters->response_max = response;
+  }
+  counters->response_sum += response;
+  counters->jobs++;
+
+  state->job_exec = 0;
+  if (tpl_dyn_proc_table[proc_id]->activate_count > 0)
+  {
+    state->release = now;
+  }
+}
+
+FUNC(tpl_status, OS_CODE) tpl_get_proc_stats_service(
+  CONST(tpl_proc_id, AUTOMATIC)                       proc_id,
+  CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_APPL_DATA) stats)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_GetProcStats)
+
+#if WITH_OS_EXTENDED == YES
+  if (!IS_STATS_PROC(proc_id))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+  /* check stats is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, stats, result);
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    *stats = tpl_proc_stats_table[proc_id].counters;
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* WITH_STATS */
+
+/* End of file tpl_os_stats_kernel.c */
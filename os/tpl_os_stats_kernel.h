@@ -0,0 +1,161 @@
+/**
+ * @file tpl_os_stats_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline runtime statistics header
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_STATS_KERNEL_H
+#define TPL_OS_STATS_KERNEL_H
+
+#include "tpl_os_internal_types.h"
+#include "tpl_os_stats.h"
+
+#if WITH_STATS == YES
+
+/**
+ * @def TPL_STATS_PROC_COUNT
+ *
+ * The idle tasks have statistics too, their exec_sum is the idle time of
+ * their core.
+ */
+#define TPL_STATS_PROC_COUNT  (TASK_COUNT + ISR_COUNT + NUMBER_OF_CORES)
+
+/**
+ * @internal
+ *
+ * Statistics of a process and the dates needed to compute them:
+ * - release is the activation date of the current job;
+ * - slice_start is the date the process got the CPU;
+ * - job_exec is the execution time of the current job until slice_start;
+ * - with LATENCY, latency is the histogram that gets the time from the
+ *   release to the start of the current job, NULL once it started or
+ *   when the job was not activated by an interrupt or an alarm.
+ */
+typedef struct {
+  tpl_proc_stats                    counters;
+  tpl_stats_time                    release;
+  tpl_stats_time                    slice_start;
+  tpl_stats_time                    job_exec;
+#if WITH_LATENCY == YES
+  P2VAR(uint32, TYPEDEF, OS_VAR)    latency;
+#endif
+} tpl_proc_stats_state;
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+extern VAR(tpl_proc_stats_state, OS_VAR)
+  tpl_proc_stats_table[TPL_STATS_PROC_COUNT];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * The statistics timer. The OS object gives its name with STATS_S::TIMER,
+ * tpl_get_stats_time by default.
+ */
+extern FUNC(tpl_stats_time, OS_CODE) TPL_STATS_TIMER(void);
+
+/**
+ * @internal
+ *
+ * An activation of proc_id has been accepted. Called before its
+ * activate_count is incremented.
+ */
+extern FUNC(void, OS_CODE) tpl_stats_on_activate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * proc_id gets the CPU.
+ */
+extern FUNC(void, OS_CODE) tpl_stats_on_run(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * proc_id loses the CPU but stays READY.
+ */
+extern FUNC(void, OS_CODE) tpl_stats_on_preempt(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * proc_id loses the CPU to wait for an event.
+ */
+extern FUNC(void, OS_CODE) tpl_stats_on_wait(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * The current job of proc_id terminates. Called after its activate_count
+ * is decremented.
+ */
+extern FUNC(void, OS_CODE) tpl_stats_on_terminate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Service GetProcStats: copies the statistics of a task or an ISR2.
+ *
+ * @param proc_id   the task or ISR2 (or IDLE_TASK_ID)
+ * @param stats     where the statistics are copied
+ *
+ * @retval  E_OK    no error
+ * @retval  E_OS_ID proc_id is invalid (extended error)
+ */
+extern FUNC(tpl_status, OS_CODE) tpl_get_proc_stats_service(
+  CONST(tpl_proc_id, AUTOMATIC)                       proc_id,
+  CONSTP2VAR(tpl_proc_stats, AUTOMATIC, OS_APPL_DATA) stats);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#  define STATS_PROC_ACTIVATE(proc_id)  do { tpl_stats_on_activate(proc_id); } while (0)
+#  define STATS_PROC_RUN(proc_id)       do { tpl_stats_on_run(proc_id); } while (0)
+#  define STATS_PROC_PREEMPT(proc_id)   do { tpl_stats_on_preempt(proc_id); } while (0)
+#  define STATS_PROC_WAIT(proc_id)      do { tpl_stats_on_wait(proc_id); } while (0)
+#  define STATS_PROC_TERMINATE(proc_id) do { tpl_stats_on_terminate(proc_id); } while (0)
+
+#else
+
+#  define STATS_PROC_ACTIVATE(proc_id)  do { } while (0)
+#  define STATS_PROC_RUN(proc_id)       do { } while (0)
+#  define STATS_PROC_PREEMPT(proc_id)   do { } while (0)
+#  define STATS_PROC_WAIT(proc_id)      do { } while (0)
+#  define STATS_PROC_TERMINATE(proc_id) do { } while (0)
+
+#endif /* WITH_STATS */
+
+#endif /* TPL_OS_STATS_KERNEL_H */
+
+/* End of file tpl_os_stats_kernel.h */
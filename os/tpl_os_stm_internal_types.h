@@ -53,32 +53,36 @@ typedef uint32 tpl_stm_core_id;
 typedef tpl_stm_core_id tpl_stm_tx_id;
 
 /**
- * @typedef tpl_stm_current_pos
+ * @typedef tpl_stm_copy_index
  *
- * Current position of concurrent data in copy_table
+ * Index of a copy of a concurrent data in the copy_table of an object.
+ * It is 32 bits wide so that it can be updated with tpl_compare_and_swap
  */
-typedef char tpl_stm_current_pos;
+typedef uint32 tpl_stm_copy_index;
 
 /**
- * @typedef tpl_stm_concurrency_vector
+ * @def TPL_STM_NO_COPY
  *
- * Object concurrency vector
+ * No copy is used (no reader on the core for read_pos, no copy
+ * staged by the write transaction for write_set)
  */
-typedef uint32 tpl_stm_concurrency_vector;
+#define TPL_STM_NO_COPY   0xFFFFFFFFu
 
 /**
- * @typedef tpl_stm_access_vector
+ * @def TPL_STM_ANNOUNCE
  *
- * Transaction access vector
+ * A reader has announced it is about to read the current copy. A committing
+ * writer replaces it by the index of the copy it has just published.
  */
-typedef uint32 tpl_stm_access_vector;
+#define TPL_STM_ANNOUNCE  0xFFFFFFFEu
 
 /**
  * @typedef tpl_stm_status
  *
- * Transaction status :
+ * Transaction status : the transaction instance number shifted by 2
+ * and one of the following states
  * - #TXS_IN_PROGRESS means the transaction is active
- * - #TXS_IN_RETRY means the transaction is in retry
+ * - #TXS_IN_RETRY means the transaction failed to commit and has to be retried
  * - #TXS_FAILED means the transaction has failed
  * - #TXS_INACTIVE means the transaction is inactive
  */
@@ -116,19 +120,24 @@ typedef uint32 tpl_stm_status;
  */
 #define TXS_INACTIVE	3
 
-
 /**
- * @typedef tpl_stm_access_vector
+ * @typedef tpl_stm_data_ref
  *
- * Transaction access vector
+ * Pointer to a copy of a concurrent data
  */
-typedef uint32 tpl_stm_access_vector;
-
+typedef P2VAR(tpl_stm_data, TYPEDEF, OS_APPL_DATA) tpl_stm_data_ref;
 
 /**
  * @typedef tpl_stm_object
  *
  * This is the internal object structure.
+ *
+ * copy_table has 1 + R + W entries where R (resp. W) is the number of cores
+ * running transactions that read (resp. write) the object. It is computed
+ * by goil from the READ_SET and WRITE_SET of the transactions. At any time
+ * one copy is the current one, each reading core protects at most one copy
+ * with its read_pos entry and each writing core stages at most one copy, so
+ * a free copy is always available to a writer.
  */
 struct TPL_STM_OBJECT {
   P2CONST(char, AUTOMATIC, OS_VAR) name;	/**< Object name
@@ -140,15 +149,18 @@ struct TPL_STM_OBJECT {
 									*/
   CONST(size_t, OS_VAR) size;			/**< Data size
 									*/
-  VAR(tpl_stm_current_pos, TYPEDEF)
-    current_pos;  	/**<  Current position of the concurrent data
-								 	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    copy_table[NUMBER_OF_CORES+2];  /**<  Table gathering the
-                      copies of the concurrent data                  	*/
-  VAR(tpl_stm_concurrency_vector, TYPEDEF)
-    concurrency_vector; /**<  Concurrency vector of the object
+  CONST(tpl_stm_copy_index, TYPEDEF)
+    copy_count;   	/**<  Number of copies of the concurrent data
 								 	*/
+  CONSTP2CONST(tpl_stm_data_ref, TYPEDEF, OS_CONST)
+    copy_table;   	/**<  Table gathering the copies of the
+                              concurrent data                           	*/
+  volatile VAR(tpl_stm_copy_index, TYPEDEF)
+    current_pos;  	/**<  Index of the current copy. Changed by
+                              the committing writer                     	*/
+  volatile VAR(tpl_stm_copy_index, TYPEDEF)
+    read_pos[NUMBER_OF_CORES]; /**<  Index of the copy read by each
+                              core, #TPL_STM_NO_COPY if none            	*/
 };
 
 /**
@@ -164,7 +176,9 @@ typedef struct TPL_STM_OBJECT tpl_stm_object;
 /**
  * @typedef TPL_STM_TX_DESCRIPTOR
  *
- * This is is the internal transaction descriptor structure.
+ * This is is the internal transaction descriptor structure. There is one
+ * descriptor per core, so only one transaction at a time may be in progress
+ * on a core.
  */
 struct TPL_STM_TX_DESCRIPTOR {
   CONST(tpl_stm_core_id, TYPEDEF)
@@ -173,15 +187,15 @@ struct TPL_STM_TX_DESCRIPTOR {
   VAR(tpl_stm_status, TYPEDEF)
     status;  		/**<  Status of the transaction
 								 	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    read_set[NUMBER_OF_OBJECTS];          /**<  Set of objects accessed
-                               	in read-only mode                     	*/
-  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA)
-    write_set[NUMBER_OF_OBJECTS];          /**<  Set of objects accessed
-                                in write mode                          	*/
-  VAR(tpl_stm_access_vector, TYPEDEF)
-    access_vector; 	/**<  Access vector of the transaction
+  VAR(tpl_bool, TYPEDEF)
+    writer;  		/**<  TRUE for a write-set transaction
 								 	*/
+  VAR(uint32, TYPEDEF)
+    start_seq;  	/**<  Value of the commit sequence when the
+                              transaction began                         	*/
+  VAR(tpl_stm_copy_index, TYPEDEF)
+    write_set[NUMBER_OF_OBJECTS];  /**<  Copy staged for each object
+                              written, #TPL_STM_NO_COPY if none         	*/
 };
 
 /**
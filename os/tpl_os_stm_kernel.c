@@ -41,10 +41,27 @@
 #include "tpl_os_event_kernel.h"*/
 
 #include "tpl_os_stm_kernel.h"
+#include "tpl_os_kernel.h"
+#include "tpl_machine_interface.h"
 
 #include <stdio.h>
 #include <string.h>
 
+#define OS_START_SEC_VAR_32BITS
+#include "tpl_memmap.h"
+
+/*
+ * The commit sequence is incremented twice by each write-set transaction
+ * commit: once before publishing the copies and once after.
+ */
+volatile VAR(uint32, OS_VAR) tpl_stm_commit_seq = 0;
+
+#define OS_STOP_SEC_VAR_32BITS
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
 /*
  * tpl_screen_display_service.
  */
@@ -68,253 +85,411 @@ FUNC(StatusType, OS_CODE) tpl_screen_display_service(
 }
 
 /*
- * tpl_stm_begin_read_tx_service
- *
- * Initializes a read-set transaction
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * tpl_stm_begin_tx
  *
+ * Starts a new instance of the transaction of the core
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service()
+STATIC FUNC(StatusType, OS_CODE) tpl_stm_begin_tx(
+  CONST(tpl_bool, AUTOMATIC) writer)
 {
- VAR(StatusType, AUTOMATIC) result = E_OK;
-
+  VAR(StatusType, AUTOMATIC) result = E_OK;
 #if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
+  GET_CURRENT_CORE_ID(core_id)
+#else
+  CONST(uint32, AUTOMATIC) core_id = 0;
+#endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
 
- LOCK_KERNEL()
+#if WITH_OS_EXTENDED == YES
+  if (STATUS(tx->status) == TXS_IN_PROGRESS)
+  {
+    result = E_OS_STATE;
+  }
+#endif
 
- /* a compléter */
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tx->writer = writer;
+    tx->start_seq = tpl_stm_commit_seq;
+    tx->status = MAKE_STATUS(INSTANCE(tx->status) + 1, TXS_IN_PROGRESS);
+  }
 
- UNLOCK_KERNEL()
-#else
- LOCK_KERNEL()
+  return result;
+}
 
- /* a compléter */
+/*
+ * tpl_stm_begin_read_tx_service
+ *
+ * Initializes a read-set transaction
+ */
+FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result;
 
- UNLOCK_KERNEL()
-#endif
+  STM_LOCK_READER()
+
+  result = tpl_stm_begin_tx(FALSE);
 
- return result;
-};
+  STM_UNLOCK_READER()
+
+  return result;
+}
 
 /*
  * tpl_stm_begin_write_tx_service
  *
- * Initializes a write-set transaction on the core given as an argument
- *
- * tx:  Transaction descriptor
- *
- * coreId:  Core on which the write-set transaction begins
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * Initializes a write-set transaction
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result;
+
+  LOCK_KERNEL()
+
+  result = tpl_stm_begin_tx(TRUE);
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
 
 /*
  * tpl_stm_end_read_tx_service
  *
  * Ends a read-set transaction
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+#if NUMBER_OF_CORES > 1
+  GET_CURRENT_CORE_ID(core_id)
+#else
+  CONST(uint32, AUTOMATIC) core_id = 0;
+#endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
+
+  STM_LOCK_READER()
+
+  CHECK_STM_TX_KIND_ERROR(tx, FALSE, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tx->status = MAKE_STATUS(INSTANCE(tx->status), TXS_INACTIVE);
+  }
+
+  STM_UNLOCK_READER()
+
+  return result;
+}
 
 /*
  * tpl_stm_end_write_tx_service
  *
  * Ends a write-set transaction
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  VAR(ObjectType, AUTOMATIC) object_id;
+#if NUMBER_OF_CORES > 1
+  GET_CURRENT_CORE_ID(core_id)
+#else
+  CONST(uint32, AUTOMATIC) core_id = 0;
+#endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
 
+  LOCK_KERNEL()
 
-/*
- * update
- *
- * A write-set transaction is ready to update an object
- *
- * tx:  Transaction descriptor
- *
- * object_id:  Object identifier
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
- */
-FUNC(StatusType, OS_CODE) update(P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx, CONST(ObjectType, AUTOMATIC) object_id){
- /* a compléter */
-};
+  CHECK_STM_TX_KIND_ERROR(tx, TRUE, result)
 
-/*
- * read_obj
- *
- * A write-set transaction is ready to update an object
- *
- * tx:  Transaction descriptor
- *
- * object_id:  Object identifier
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
- */
-FUNC(StatusType, OS_CODE) read_obj(CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx1, CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx2, CONST(ObjectType, AUTOMATIC) object_id, CONST(uint32, AUTOMATIC) instance){
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /* the copies that have not been committed go back to the free ones */
+    for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+    {
+      tx->write_set[object_id] = TPL_STM_NO_COPY;
+    }
+    tx->status = MAKE_STATUS(INSTANCE(tx->status), TXS_INACTIVE);
+  }
 
-  char loc_current_pos;
-  char read_copy_index;
+  UNLOCK_KERNEL()
 
-  if ((STATUS(trans_table[coreid_tx2].status) == TXS_IN_RETRY) && (INSTANCE(trans_table[coreid_tx2].status) == instance))
- 	object_table[object_id].concurrency_vector = SET_FAIL_VECTOR(object_table[object_id].concurrency_vector, coreid_tx2);
+  return result;
+}
 
-  do
+/*
+ * tpl_stm_free_copy
+ *
+ * Looks for a copy of an object that is not the current one, is not read
+ * by a core and is not staged by a write-set transaction. Called with the
+ * kernel locked.
+ */
+STATIC FUNC(tpl_stm_copy_index, OS_CODE) tpl_stm_free_copy(
+  CONST(ObjectType, AUTOMATIC) object_id)
+{
+  CONSTP2VAR(tpl_stm_object, AUTOMATIC, OS_APPL_DATA) obj =
+    &object_table[object_id];
+  VAR(tpl_stm_copy_index, AUTOMATIC) copy;
+  VAR(tpl_stm_copy_index, AUTOMATIC) result = TPL_STM_NO_COPY;
+  VAR(uint32, AUTOMATIC) core;
+  VAR(tpl_bool, AUTOMATIC) used;
+
+  for (copy = 0; (copy < obj->copy_count) && (result == TPL_STM_NO_COPY); copy++)
   {
-	SET_READ_VECTOR(object_table[object_id].concurrency_vector, coreid_tx2);
-	loc_current_pos = CURRENT_OBJECT_POS(object_table[object_id].concurrency_vector);
-	read_copy_index = 2 + coreid_tx2;
-	printf("data dans la structure object_table à current_pos = %d\n", *(int*)object_table[object_id].copy_table[object_table[object_id].current_pos]);
-	object_table[object_id].copy_table[read_copy_index] = object_table[object_id].copy_table[loc_current_pos];
-	printf("data dans la structure object_table à read_copy_index = %d\n",  *(int*)object_table[object_id].copy_table[read_copy_index]);
-	if (READ_VECTOR_BIT(object_table[object_id].concurrency_vector, coreid_tx2))
-		break;
-
+    used = (tpl_bool)(copy == obj->current_pos);
+    for (core = 0; (core < NUMBER_OF_CORES) && (used == FALSE); core++)
+    {
+      used = (tpl_bool)((obj->read_pos[core] == copy) ||
+                        (trans_table[core].write_set[object_id] == copy));
+    }
+    if (used == FALSE)
+    {
+      result = copy;
+    }
   }
-  while(1);
 
+  return result;
+}
 
-  if ((INSTANCE(trans_table[coreid_tx2].status) == instance) && (STATUS(trans_table[coreid_tx2].status) < TXS_INACTIVE))
+/*
+ * update
+ *
+ * Publishes the copy of an object staged by a write-set transaction
+ */
+FUNC(void, OS_CODE) update(
+  P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx,
+  CONST(ObjectType, AUTOMATIC) object_id)
+{
+  CONSTP2VAR(tpl_stm_object, AUTOMATIC, OS_APPL_DATA) obj =
+    &object_table[object_id];
+  CONST(tpl_stm_copy_index, AUTOMATIC) staged = tx->write_set[object_id];
+  VAR(uint32, AUTOMATIC) core;
+
+  /* the staged copy becomes the current one */
+  obj->current_pos = staged;
+
+  /*
+   * help the readers that have announced themselves but not yet got
+   * their copy: they get the one just published. This way, a reader
+   * that got the previous copy has set its read_pos before the previous
+   * copy may be reused by a writer.
+   */
+  for (core = 0; core < NUMBER_OF_CORES; core++)
   {
-	/* ATOMIC */
-	if (trans_table[coreid_tx1].read_set[object_id] == &object_table[object_id])
-		trans_table[coreid_tx1].read_set[object_id] = object_table[object_id].copy_table[read_copy_index];
+    (void)STM_CAS(obj->read_pos[core], TPL_STM_ANNOUNCE, staged);
   }
-  printf("data dans la structure trans_table = %d\n", *(int*)trans_table[coreid_tx1].read_set[object_id]);
-};
 
+  tx->write_set[object_id] = TPL_STM_NO_COPY;
+}
 
 /*
- * tpl_stm_open_read_object_service
- *
- * A read-set transaction opens for reading a given object
- *
- * object_id:  Object identifier
- *
- * data:  Data
- *
- * data_size:  Data size
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * read_obj
  *
+ * Copies the current copy of an object in data
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data){
-
-uint32 instance;
+FUNC(void, OS_CODE) read_obj(
+  CONST(tpl_stm_core_id, AUTOMATIC) core_id,
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data)
+{
+  CONSTP2VAR(tpl_stm_object, AUTOMATIC, OS_APPL_DATA) obj =
+    &object_table[object_id];
+  VAR(tpl_stm_copy_index, AUTOMATIC) pos;
+
+  /* announce the read, then try to protect the current copy */
+  (void)STM_CAS(obj->read_pos[core_id], TPL_STM_NO_COPY, TPL_STM_ANNOUNCE);
+  pos = obj->current_pos;
+  (void)STM_CAS(obj->read_pos[core_id], TPL_STM_ANNOUNCE, pos);
+
+  /*
+   * if the compare and swap failed, a writer committed in the meantime
+   * and set the read position to the copy it published.
+   */
+  pos = obj->read_pos[core_id];
+  memcpy(data, obj->copy_table[pos], obj->size);
+
+  obj->read_pos[core_id] = TPL_STM_NO_COPY;
+}
 
+/*
+ * tpl_stm_open_read_object_service
+ *
+ * A transaction opens for reading a given object
+ */
+FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
 #if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
+  GET_CURRENT_CORE_ID(core_id)
 #else
- uint32 core_id = 0;
+  CONST(uint32, AUTOMATIC) core_id = 0;
 #endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
 
-  LOCK_KERNEL()
+  STM_LOCK_READER()
 
-  printf("DEBUT : data pointée = %d, adresse pointée par data=%p\n", *(int*)data, data);
+  CHECK_STM_OBJECT_ID_ERROR(object_id, result)
+  CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)
 
-  if ((STATUS(trans_table[core_id].status) != TXS_IN_RETRY) && (UPDATE_FLAG(object_table[object_id].concurrency_vector)==1))
+  IF_NO_EXTENDED_ERROR(result)
   {
-	printf("Statut de la transaction différent de TXS_RETRY et update flag de l'objet à 1...\n");
-	update(writer_table[object_id], object_id);
+    if ((tx->writer == TRUE) && (tx->write_set[object_id] != TPL_STM_NO_COPY))
+    {
+      /* a write-set transaction reads what it has written */
+      memcpy(data,
+             object_table[object_id].copy_table[tx->write_set[object_id]],
+             object_table[object_id].size);
+    }
+    else
+    {
+      read_obj(core_id, object_id, data);
+    }
   }
 
-  /* ATOMIC(&trans_table[core_id].read_set[object_id], NULL, &object_table[object_id]);  // inutile car déjà initialisé ainsi dans le template STM-HRT */
-  instance = INSTANCE(trans_table[core_id].status);
-  read_obj(core_id, core_id, object_id, instance);
-  SET_ACCESS_VECTOR(trans_table[core_id].access_vector, object_id);
-  printf("Data size = %zd\n", object_table[object_id].size);
-  memcpy(data, trans_table[core_id].read_set[object_id], object_table[object_id].size);
-
-  printf("FIN : data pointée = %d, adresse pointée par data=%p\n", *(int*)data, data);
-
-  UNLOCK_KERNEL()
+  STM_UNLOCK_READER()
 
-};
+  return result;
+}
 
 /*
  * tpl_stm_open_write_object_service
  *
  * A write-set transaction opens for writing a given object
- *
- * object_id:  Object identifier
- *
- * data:  Data
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data){
-
+FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
 #if NUMBER_OF_CORES > 1
- GET_CURRENT_CORE_ID(core_id)
+  GET_CURRENT_CORE_ID(core_id)
 #else
- uint32 core_id = 0;
+  CONST(uint32, AUTOMATIC) core_id = 0;
 #endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
 
   LOCK_KERNEL()
 
-  memcpy(trans_table[core_id].write_set[object_id], data, object_table[object_id].size);
-  SET_UPDATE_FLAG(object_table[object_id].concurrency_vector);
-  SET_ACCESS_VECTOR(trans_table[core_id].access_vector, object_id);
+  CHECK_STM_OBJECT_ID_ERROR(object_id, result)
+  CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)
+  CHECK_STM_TX_KIND_ERROR(tx, TRUE, result)
 
-  printf("Valeur data dans copy_table = %d\n", *(int*)trans_table[core_id].write_set[object_id]);
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    if (tx->write_set[object_id] == TPL_STM_NO_COPY)
+    {
+      tx->write_set[object_id] = tpl_stm_free_copy(object_id);
+    }
+    if (tx->write_set[object_id] != TPL_STM_NO_COPY)
+    {
+      memcpy(object_table[object_id].copy_table[tx->write_set[object_id]],
+             data,
+             object_table[object_id].size);
+    }
+    else
+    {
+      result = E_OS_LIMIT;
+    }
+  }
 
   UNLOCK_KERNEL()
 
-};
+  return result;
+}
 
 /*
  * tpl_stm_commit_read_tx_service
  *
- * A read-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * instance:  Transaction instance number
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * A read-set transaction tries to commit on the current core
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+#if NUMBER_OF_CORES > 1
+  GET_CURRENT_CORE_ID(core_id)
+#else
+  CONST(uint32, AUTOMATIC) core_id = 0;
+#endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
+
+  STM_LOCK_READER()
+
+  CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)
+  CHECK_STM_TX_KIND_ERROR(tx, FALSE, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /*
+     * the objects read are consistent if no write-set transaction
+     * was committing when the transaction began and none committed since.
+     */
+    if (((tx->start_seq & 1u) == 0) && (tx->start_seq == tpl_stm_commit_seq))
+    {
+      tx->status = MAKE_STATUS(INSTANCE(tx->status), TXS_INACTIVE);
+    }
+    else
+    {
+      tx->status = MAKE_STATUS(INSTANCE(tx->status), TXS_IN_RETRY);
+      result = E_OS_STATE;
+    }
+  }
+
+  STM_UNLOCK_READER()
+
+  return result;
+}
 
 /*
  * tpl_stm_commit_write_tx_service
  *
- * A write-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * Return value:
- * E_OK:    No error (Standard & Extended)
- *
+ * A write-set transaction commits on the current core
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(){
-};
+FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(void)
+{
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+  VAR(ObjectType, AUTOMATIC) object_id;
+#if NUMBER_OF_CORES > 1
+  GET_CURRENT_CORE_ID(core_id)
+#else
+  CONST(uint32, AUTOMATIC) core_id = 0;
+#endif
+  CONSTP2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx =
+    &trans_table[core_id];
+
+  LOCK_KERNEL()
+
+  CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)
+  CHECK_STM_TX_KIND_ERROR(tx, TRUE, result)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /* odd sequence: the copies are being published */
+    tpl_stm_commit_seq++;
+    for (object_id = 0; object_id < NUMBER_OF_OBJECTS; object_id++)
+    {
+      if (tx->write_set[object_id] != TPL_STM_NO_COPY)
+      {
+        update(tx, object_id);
+      }
+    }
+    tpl_stm_commit_seq++;
+    tx->status = MAKE_STATUS(INSTANCE(tx->status), TXS_INACTIVE);
+  }
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
 
+/* End of file tpl_os_stm_kernel.c */
@@ -41,35 +41,69 @@ extern VAR(tpl_stm_tx_descriptor, OS_APPL_DATA) trans_table[NUMBER_OF_CORES];
 extern VAR(tpl_stm_object, OS_APPL_DATA) object_table[NUMBER_OF_OBJECTS];
 
 /**
- * Array of all transaction descriptors of writers
+ * Commit sequence. It is odd while a write-set transaction publishes its
+ * copies and is used by read-set transactions to check the objects they
+ * read are consistent.
  *
   */
-extern P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) writer_table[NUMBER_OF_OBJECTS];
+extern volatile VAR(uint32, OS_VAR) tpl_stm_commit_seq;
 
 
 /********************************************************************************
 *				Macros						*
 *										*
 ********************************************************************************/
-#define INSTANCE(status)			((status >> 2) & 0xFFFFFFFF)
+#define INSTANCE(status)			((status >> 2) & 0x3FFFFFFF)
 #define STATUS(status)				(status & 3)
 
-#define CURRENT_OBJECT_POS(concurrency_vector)	((concurrency_vector >> 30) & 1u )
-#define UPDATE_FLAG(concurrency_vector)		((concurrency_vector >> 31) & 1u )
-#define READ_VECTOR(concurrency_vector)		((concurrency_vector & NUMBER_OF_CORES))
-#define FAIL_VECTOR(concurrency_vector)		((concurrency_vector >> NUMBER_OF_CORES) & (POW2_NUMBER_OF_CORES-1))
+#define MAKE_STATUS(instance, state)		(((instance) << 2) | (state))
 
-#define SET_READ_VECTOR(concurrency_vector, core_id) 	concurrency_vector = (concurrency_vector | (1u << (core_id)))
-#define READ_VECTOR_BIT(concurrency_vector, core_id) 	((concurrency_vector >> core_id) & 1u )
-
-#define SET_FAIL_VECTOR(concurrency_vector, core_id) 	concurrency_vector = (concurrency_vector | (1u << (NUMBER_OF_CORES + core_id)))
-
-#define POW2_NUMBER_OF_CORES (1 << NUMBER_OF_CORES)
-
-#define SET_UPDATE_FLAG(concurrency_vector)	concurrency_vector = (concurrency_vector |  (1u << 31))
-
-#define SET_ACCESS_VECTOR(access_vector, object_id) 	access_vector = (access_vector | (1u  << object_id))
+/*
+ * In multicore, readers do not take the kernel lock, so the read positions
+ * are updated with tpl_compare_and_swap. In monocore, all the services are
+ * done with the kernel locked and a plain compare and store is enough.
+ * In both cases STM_CAS is an expression that is TRUE if the swap has
+ * been done.
+ */
+#if NUMBER_OF_CORES > 1
+#define STM_CAS(addr, expected, desired) \
+  tpl_compare_and_swap(&(addr), (expected), (desired))
+#define STM_LOCK_READER()
+#define STM_UNLOCK_READER()
+#else
+#define STM_CAS(addr, expected, desired) \
+  ((tpl_bool)(((addr) == (expected)) ? (((addr) = (desired)), TRUE) : FALSE))
+#define STM_LOCK_READER()     LOCK_KERNEL()
+#define STM_UNLOCK_READER()   UNLOCK_KERNEL()
+#endif
 
+/*
+ * Extended error checking of the STM services
+ */
+#if WITH_OS_EXTENDED == YES
+#define CHECK_STM_OBJECT_ID_ERROR(object_id, result)          \
+  if ((result == (tpl_status)E_OK) &&                         \
+      ((object_id) >= (ObjectType)NUMBER_OF_OBJECTS))         \
+  {                                                           \
+    result = (tpl_status)E_OS_ID;                             \
+  }
+#define CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)            \
+  if ((result == (tpl_status)E_OK) &&                         \
+      (STATUS((tx)->status) != TXS_IN_PROGRESS))              \
+  {                                                           \
+    result = (tpl_status)E_OS_STATE;                          \
+  }
+#define CHECK_STM_TX_KIND_ERROR(tx, is_writer, result)        \
+  if ((result == (tpl_status)E_OK) &&                         \
+      ((tx)->writer != (is_writer)))                          \
+  {                                                           \
+    result = (tpl_status)E_OS_ACCESS;                         \
+  }
+#else
+#define CHECK_STM_OBJECT_ID_ERROR(object_id, result)
+#define CHECK_STM_TX_IN_PROGRESS_ERROR(tx, result)
+#define CHECK_STM_TX_KIND_ERROR(tx, is_writer, result)
+#endif
 
 
 
@@ -93,86 +127,104 @@ FUNC(StatusType, OS_CODE) tpl_screen_display_service(
 /*
  * tpl_stm_begin_read_tx_service
  *
- * Initializes a read-set transaction
+ * Initializes a read-set transaction on the current core
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_STATE:  A transaction is already in progress on the core (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_begin_read_tx_service(void);
 
 /*
  * tpl_stm_begin_write_tx_service
  *
- * Initializes a write-set transaction on the core given as an argument
- *
- * tx:  Transaction descriptor
- *
- * coreId:  Core on which the write-set transaction begins
+ * Initializes a write-set transaction on the current core
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_STATE:  A transaction is already in progress on the core (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_begin_write_tx_service(void);
 
 /*
  * tpl_stm_end_read_tx_service
  *
  * Ends a read-set transaction
  *
- * tx:  Transaction descriptor
- *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_ACCESS: The transaction is a write-set one (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_end_read_tx_service(void);
 
 /*
  * tpl_stm_end_write_tx_service
  *
- * Ends a write-set transaction
- *
- * tx:  Transaction descriptor
+ * Ends a write-set transaction. The copies staged and not committed
+ * are discarded
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_ACCESS: The transaction is a read-set one (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_end_write_tx_service(void);
 
 /*
  * @internal
  *
  * read_obj
  *
- * A write-set transaction is ready to update an object
+ * Copies the current copy of an object in data. This function never
+ * blocks: the read position of the core is announced, then set to the
+ * current copy unless a committing writer already set it.
  *
- * tx:  Transaction descriptor
+ * core_id:    Core of the reader
  *
  * object_id:  Object identifier
  *
- * Return value:
- * E_OK:    No error (Standard & Extended)
+ * data:       Where the data is copied
  *
  */
-FUNC(StatusType, OS_CODE) read_obj(CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx1, CONST(tpl_stm_core_id, OS_APPL_DATA) coreid_tx2, CONST(ObjectType, AUTOMATIC) object_id, CONST(uint32, AUTOMATIC) instance);
+FUNC(void, OS_CODE) read_obj(
+  CONST(tpl_stm_core_id, AUTOMATIC) core_id,
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
 
+/*
+ * @internal
+ *
+ * update
+ *
+ * Publishes the copy of an object staged by a write-set transaction.
+ * Called with the kernel locked.
+ *
+ * tx:         Transaction descriptor
+ *
+ * object_id:  Object identifier
+ *
+ */
+FUNC(void, OS_CODE) update(
+  P2VAR(tpl_stm_tx_descriptor, AUTOMATIC, OS_APPL_DATA) tx,
+  CONST(ObjectType, AUTOMATIC) object_id);
 
 /*
  * tpl_stm_open_read_object_service
  *
- * A read-set transaction opens for reading a given object
+ * A transaction opens for reading a given object. The value is copied
+ * in data. A write-set transaction reads its own staged copy.
  *
  * object_id:  Object identifier
  *
  * data:  Data
  *
- * data_size:  Data size
- *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_ID:     object_id is invalid (Extended)
+ * E_OS_STATE:  No transaction in progress on the core (Extended)
  *
  */
 FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(
@@ -182,44 +234,51 @@ FUNC(StatusType, OS_CODE) tpl_stm_open_read_object_service(
  /*
  * tpl_stm_open_write_object_service
  *
- * A write-set transaction opens for writing a given object
+ * A write-set transaction opens for writing a given object. data is
+ * copied in a free copy of the object that will be published at commit.
  *
  * object_id:  Object identifier
  *
  * data:  Data
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_ID:     object_id is invalid (Extended)
+ * E_OS_STATE:  No transaction in progress on the core (Extended)
+ * E_OS_ACCESS: The transaction is a read-set one (Extended)
+ * E_OS_LIMIT:  No free copy, the object is not in the WRITE_SET of
+ *              a transaction of the core
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(CONST(ObjectType, AUTOMATIC) object_id, P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
+FUNC(StatusType, OS_CODE) tpl_stm_open_write_object_service(
+  CONST(ObjectType, AUTOMATIC) object_id,
+  P2VAR(tpl_stm_data, AUTOMATIC, OS_APPL_DATA) data);
 
 /*
  * tpl_stm_commit_read_tx_service
  *
- * A read-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
- *
- * instance:  Transaction instance number
+ * A read-set transaction tries to commit on the current core
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error, the objects read are consistent
+ * E_OS_STATE:  A write-set transaction committed while the objects were
+ *              read, the transaction is in retry and has to be done again
+ * E_OS_ACCESS: The transaction is a write-set one (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service();
+FUNC(StatusType, OS_CODE) tpl_stm_commit_read_tx_service(void);
 
 /*
  * tpl_stm_commit_write_tx_service
  *
- * A write-set transaction tries to commit on a given core
- *
- * tx:  Transaction descriptor
+ * A write-set transaction commits on the current core. The staged copies
+ * become the current ones.
  *
  * Return value:
- * E_OK:    No error (Standard & Extended)
+ * E_OK:        No error (Standard & Extended)
+ * E_OS_STATE:  No transaction in progress on the core (Extended)
+ * E_OS_ACCESS: The transaction is a read-set one (Extended)
  *
  */
-FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service();
-
+FUNC(StatusType, OS_CODE) tpl_stm_commit_write_tx_service(void);
 
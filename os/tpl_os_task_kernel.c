@@ -102,6 +102,48 @@ FUNC(StatusType, OS_CODE) tpl_activate_task_service(
 }
 
 
+/*
+ * ActivateTask_<task>: the task id is a constant of the OIL file, there
+ * is no id check.
+ */
+FUNC(StatusType, OS_CODE) tpl_activate_task_static_service(
+  CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_PROC_CORE_ID(task_id, proc_core_id)
+
+  VAR(StatusType, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_ActivateTask)
+  STORE_TASK_ID(task_id)
+
+  /* check access right */
+  CHECK_ACCESS_RIGHTS_TASK_ID(core_id, task_id, result)
+
+#if TASK_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    result = tpl_activate_task(task_id);
+    if (TPL_KERN(proc_core_id).need_schedule)
+    {
+      tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
+      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
+    }
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+
 FUNC(StatusType, OS_CODE) tpl_terminate_task_service(void)
 {
   GET_CURRENT_CORE_ID(core_id)
@@ -79,6 +79,20 @@ extern CONSTP2VAR(tpl_task_events, AUTOMATIC, OS_APPL_DATA)
 FUNC(tpl_status, OS_CODE) tpl_activate_task_service(
   CONST(tpl_task_id, AUTOMATIC)   task_id);
 
+/**
+ * Activates a task whose identifier is a constant of the OIL file.
+ *
+ * It is called by the ActivateTask_<task> macros goil generates in
+ * tpl_os.h. Since task_id is valid by construction, it is not checked.
+ *
+ * @param   task_id     identifier of the task to be activated
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_LIMIT  too many task activations
+ */
+FUNC(tpl_status, OS_CODE) tpl_activate_task_static_service(
+  CONST(tpl_task_id, AUTOMATIC)   task_id);
+
 
 /**
  * Terminates the execution of a task.
@@ -309,6 +309,51 @@ extern FUNC(void, OS_CODE) printrl(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg);
 
 FUNC(void, OS_CODE) tpl_counter_tick(
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
+{
+  if (tpl_counters_enabled)
+  {
+    /*  inc the current tick value of the counter     */
+    counter->current_tick++;
+    /*  if tickperbase is reached, the counter is inc */
+    if (counter->current_tick == counter->ticks_per_base)
+    {
+      counter->current_tick = 0;
+      tpl_counter_advance(counter);
+    }
+  }
+}
+
+/*
+ * tpl_counter_prescale is called by the IT shared by the counters
+ * of a same ticks per base when goil multiplexes them. The phase is
+ * common to all these counters, so it is incremented once per tick
+ * instead of the current_tick of each counter.
+ */
+FUNC(tpl_bool, OS_CODE) tpl_counter_prescale(
+  P2VAR(tpl_tick, AUTOMATIC, OS_APPL_DATA) phase,
+  VAR(tpl_tick, AUTOMATIC) ticks_per_base)
+{
+  VAR(tpl_bool, AUTOMATIC) advance = FALSE;
+
+  if (tpl_counters_enabled)
+  {
+    (*phase)++;
+    if (*phase == ticks_per_base)
+    {
+      *phase = 0;
+      advance = TRUE;
+    }
+  }
+
+  return advance;
+}
+
+/*
+ * tpl_counter_advance increments the date of a counter whose
+ * ticks per base is reached and raises the time objects at that date.
+ */
+FUNC(void, OS_CODE) tpl_counter_advance(
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
 {
   P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA)  t_obj;
   /* temporary pointeur to adjust the next object of a counter when the first time
@@ -328,77 +373,70 @@ FUNC(void, OS_CODE) tpl_counter_tick(
 
   if (tpl_counters_enabled)
   {
-    /*  inc the current tick value of the counter     */
-    counter->current_tick++;
-    /*  if tickperbase is reached, the counter is inc */
-    if (counter->current_tick == counter->ticks_per_base)
+    date = counter->current_date;
+    date++;
+    if (date > counter->max_allowed_value)
     {
-      date = counter->current_date;
-      date++;
-      if (date > counter->max_allowed_value)
-      {
-        date = 0;
-      }
-      counter->current_date = date;
-      counter->current_tick = 0;
+      date = 0;
+    }
+    counter->current_date = date;
 
-      TRACE_COUNTER(counter)
+    TRACE_COUNTER(counter);
 
-      /*  check if the counter has reached the
-       next alarm activation date                  */
-      t_obj = counter->next_to;
+    /*  check if the counter has reached the
+     next alarm activation date                  */
+    t_obj = counter->next_to;
 
-      if ((t_obj != NULL) && (t_obj->date == date))
-      {
-        /*  the date of the counter has reached
-         the date of the next time obj.
-         extract the time object with this date
-         from the list. (if object from schedule
-         table has been BOOTSTRAP, don't process
-         the expiry point(s))								*/
+    if ((t_obj != NULL) && (t_obj->date == date))
+    {
+      /*  the date of the counter has reached
+       the date of the next time obj.
+       extract the time object with this date
+       from the list. (if object from schedule
+       table has been BOOTSTRAP, don't process
+       the expiry point(s))								*/
 
-        real_next_to_temp = tpl_remove_timeobj_set(counter);
+      real_next_to_temp = tpl_remove_timeobj_set(counter);
 
-        if( real_next_to_temp != NULL)
+      if( real_next_to_temp != NULL)
+      {
+        /* save the "real one" next_to (in case of a schedule table,
+         if the first time object is a BOOTSTRAP, change the next_to's
+         counter to the first time object "NO BOOTSTRAP" otherwise, the
+         time object BOOSTRAP is inserted in the list because of its
+         cycle (after launching actions below). */
+        t_obj = real_next_to_temp;
+
+        /*launch time objects' actions*/
+        do
         {
-          /* save the "real one" next_to (in case of a schedule table,
-           if the first time object is a BOOTSTRAP, change the next_to's
-           counter to the first time object "NO BOOTSTRAP" otherwise, the
-           time object BOOSTRAP is inserted in the list because of its
-           cycle (after launching actions below). */
-          t_obj = real_next_to_temp;
-
-          /*launch time objects' actions*/
-          do
-          {
-            /*  get the next one                        */
-            tpl_time_obj *next_to = t_obj->next_to;
-            expire = t_obj->stat_part->expire;
-            expire(t_obj);
-            /*  rearm the alarm if needed               */
+          /*  get the next one                        */
+          tpl_time_obj *next_to = t_obj->next_to;
+          expire = t_obj->stat_part->expire;
+          expire(t_obj);
+          /*  rearm the alarm if needed               */
 
-            if (t_obj->cycle != 0)
+          if (t_obj->cycle != 0)
+          {
+            /*  if the cycle is not 0, the new date
+             is computed by adding the cycle to
+             the current date                      */
+            new_date = t_obj->date + t_obj->cycle;
+            if (new_date > counter->max_allowed_value)
             {
-              /*  if the cycle is not 0, the new date
-               is computed by adding the cycle to
-               the current date                      */
-              new_date = t_obj->date + t_obj->cycle;
-              if (new_date > counter->max_allowed_value)
-              {
-                new_date -= (counter->max_allowed_value + 1);
-              }
-              t_obj->date = new_date;
-
-              /*  and the alarm is put back in the alarm
-               queue of the counter it belongs to    */
-              tpl_insert_time_obj(t_obj);
+              new_date -= (counter->max_allowed_value + 1);
             }
-            else {
-              t_obj->state = TIME_OBJ_SLEEP;
-            }
-            t_obj = next_to;
-          } while (t_obj != NULL);
-        }
+            t_obj->date = new_date;
+
+            /*  and the alarm is put back in the alarm
+             queue of the counter it belongs to    */
+            tpl_insert_time_obj(t_obj);
+          }
+          else {
+            t_obj->state = TIME_OBJ_SLEEP;
+          }
+          t_obj = next_to;
+        } while (t_obj != NULL);
       }
     }
   }
@@ -451,7 +489,7 @@ FUNC(void, OS_CODE) tpl_increment_counter(
         counter->current_date = date;
         counter->current_tick = 0;
 
-        TRACE_COUNTER(counter)
+        TRACE_COUNTER(counter);
       }
     }
   }
@@ -70,10 +70,11 @@ struct TPL_TIME_OBJ_STATIC {
   CONST(tpl_expire_func, TYPEDEF)
     expire;       /**<  expiration processing to be done when the time object
                     expires                                                   */
-#if (WITH_TRACE == YES)
+#if (WITH_TRACE == YES) || (WITH_LATENCY == YES)
   CONST(tpl_timeobj_id, TYPEDEF)
     timeobj_id;   /**<  the id of the alarm or schedule table. This id
-                        is used for tracing the kernel                        */
+                        is used for tracing the kernel and for the latency
+                        histograms                                            */
 #endif
 #if WITH_OSAPPLICATION == YES
   CONST(tpl_app_id, TYPEDEF)
@@ -216,6 +217,36 @@ FUNC(void, OS_CODE) tpl_remove_time_obj(
 FUNC(void, OS_CODE) tpl_counter_tick(
     P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter);
 
+/**
+ * @internal
+ *
+ * tpl_counter_prescale counts a tick of the counters of a same ticks
+ * per base multiplexed on one IT by goil. These counters share a single
+ * phase and their current_tick stays at 0.
+ *
+ * @param phase           A pointer to the phase shared by the counters
+ * @param ticks_per_base  The ticks per base of the counters
+ *
+ * @retval TRUE   the ticks per base is reached, the counters advance
+ * @retval FALSE  otherwise
+ */
+FUNC(tpl_bool, OS_CODE) tpl_counter_prescale(
+    P2VAR(tpl_tick, AUTOMATIC, OS_APPL_DATA) phase,
+    VAR(tpl_tick, AUTOMATIC) ticks_per_base);
+
+/**
+ * @internal
+ *
+ * tpl_counter_advance increments the counter value without prescaling,
+ * checks the next alarm date and raises alarms at that date. It is
+ * called by tpl_counter_tick when the ticks per base is reached and
+ * directly by the IT for a multiplexed counter.
+ *
+ * @param counter    A pointer to the counter
+ */
+FUNC(void, OS_CODE) tpl_counter_advance(
+    P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter);
+
 #if TPL_OPTIMIZE_TICKS == YES
 FUNC(tpl_tick, OS_CODE) tpl_time_before_next_tick(
   P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter);
@@ -0,0 +1,102 @@
+/**
+ * @file tpl_os_trace.h
+ *
+ * @section desc File description
+ *
+ * Trampoline trace control header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_TRACE_H
+#define TPL_OS_TRACE_H
+
+#include "tpl_os_std_types.h"
+
+/**
+* @def IDs of the different traces
+*/
+
+#define TASK_RUN 0
+#define TASK_PREEMPT 1
+#define TASK_TERMINATE 2
+#define TASK_ACTIVATE 3
+#define TASK_WAIT 4
+#define TASK_RELEASED 5
+#define TASK_CHANGE_PRIORITY 6
+#define RES_GET 7
+#define RES_RELEASED 8
+#define ISR_RUN 9
+#define ISR_PREEMPT 10
+#define ISR_TERMINATE 11
+#define ISR_ACTIVATE 12
+#define ISR_CHANGE_PRIORITY 13
+#define ALARM_SCHEDULED 14
+#define ALARM_EXPIRE 15
+#define ALARM_CANCEL 16
+#define USER_EVENT 17
+#define TPL_INIT 18
+#define TPL_TERMINATE 19
+#define COUNTER_INC 20
+
+/**
+ * @def TRACE_CLASS
+ *
+ * Bit of a trace id in the classes given to SetTraceFilter
+ */
+#define TRACE_CLASS(trace_id)   ((uint32)1 << (trace_id))
+
+#define TRACE_CLASSES_TASK                \
+  (TRACE_CLASS(TASK_RUN) |                \
+   TRACE_CLASS(TASK_PREEMPT) |            \
+   TRACE_CLASS(TASK_TERMINATE) |          \
+   TRACE_CLASS(TASK_ACTIVATE) |           \
+   TRACE_CLASS(TASK_WAIT) |               \
+   TRACE_CLASS(TASK_RELEASED) |           \
+   TRACE_CLASS(TASK_CHANGE_PRIORITY))
+
+#define TRACE_CLASSES_RES                 \
+  (TRACE_CLASS(RES_GET) |                 \
+   TRACE_CLASS(RES_RELEASED))
+
+#define TRACE_CLASSES_ISR                 \
+  (TRACE_CLASS(ISR_RUN) |                 \
+   TRACE_CLASS(ISR_PREEMPT) |             \
+   TRACE_CLASS(ISR_TERMINATE) |           \
+   TRACE_CLASS(ISR_ACTIVATE) |            \
+   TRACE_CLASS(ISR_CHANGE_PRIORITY))
+
+#define TRACE_CLASSES_ALARM               \
+  (TRACE_CLASS(ALARM_SCHEDULED) |         \
+   TRACE_CLASS(ALARM_EXPIRE) |            \
+   TRACE_CLASS(ALARM_CANCEL) |            \
+   TRACE_CLASS(COUNTER_INC))
+
+#define TRACE_CLASSES_ALL       ((uint32)0xFFFFFFFF)
+
+/**
+ * @def TRACE_ALL_PROCS
+ *
+ * Given to SetTraceProc instead of a task or an ISR2 to select or to
+ * filter out all of them
+ */
+#define TRACE_ALL_PROCS         (-1)
+
+#endif /* TPL_OS_TRACE_H */
+
+/* End of file tpl_os_trace.h */
@@ -28,11 +28,75 @@
 #include "tpl_os_types.h"
 #include "tpl_os_alarm_kernel.h"
 #include "tpl_os_timeobj_kernel.h"
+#include "tpl_os_error.h"
 #include "tpl_trace.h"
 
+#if WITH_TRACE == YES
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+VAR(tpl_trace_control, OS_VAR) tpl_trace_ctrl = {
+  TRACE_INITIAL_CLASSES,  /* classes        */
+  TRACE_SAMPLING,         /* sampling       */
+  0,                      /* countdown      */
+  { 0 }                   /* masked_procs   */
+};
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
+/**
+* FILTERING FUNCTIONS
+*/
+
+/*
+ * tpl_trace_sampled
+ *
+ * Counts an event that passed the filters, TRUE if it is recorded
+ */
+STATIC FUNC(tpl_bool, OS_CODE) tpl_trace_sampled(void)
+{
+  VAR(tpl_bool, AUTOMATIC) sampled = TRUE;
+
+  if (tpl_trace_ctrl.countdown > 1)
+  {
+    tpl_trace_ctrl.countdown--;
+    sampled = FALSE;
+  }
+  else
+  {
+    tpl_trace_ctrl.countdown = tpl_trace_ctrl.sampling;
+  }
+
+  return sampled;
+}
+
+/*
+ * tpl_trace_selected
+ *
+ * TRUE if an event of proc_id is recorded. The idle task and an invalid
+ * id are never filtered out.
+ */
+STATIC FUNC(tpl_bool, OS_CODE) tpl_trace_selected(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONST(uint32, AUTOMATIC) index = (uint32)proc_id;
+  VAR(tpl_bool, AUTOMATIC) selected = TRUE;
+
+  if (index < (TASK_COUNT + ISR_COUNT))
+  {
+    selected =
+      ((tpl_trace_ctrl.masked_procs[index >> 5] & ((uint32)1 << (index & 31)))
+        == 0);
+  }
+
+  return selected && tpl_trace_sampled();
+}
+
 /**
 * TASKS FUNCTIONS
 */
@@ -44,7 +108,8 @@ FUNC(void, OS_CODE) tpl_trace_task_execute(
   VAR(tpl_status, AUTOMATIC) new_executed_task_old_status;
   VAR(tpl_priority, AUTOMATIC) new_executed_task_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type != 0x2)
+  if((TPL_KERN_REF(kern).s_running->type != 0x2) &&
+     tpl_trace_selected(new_executed_task_id))
     {
 /* This function is called just before the scheduling process,
     so we can get the status of the task before it changes.*/
@@ -69,7 +134,8 @@ FUNC(void, OS_CODE) tpl_trace_task_preempt(
 {
   VAR(tpl_priority, AUTOMATIC) preempted_task_prio;
 
-  if (tpl_stat_proc_table[preempted_task_id]->type != IS_ROUTINE)
+  if ((tpl_stat_proc_table[preempted_task_id]->type != IS_ROUTINE) &&
+      tpl_trace_selected(preempted_task_id))
   {
     /*
      * we retrieve the preempted task's data by requesting
@@ -92,7 +158,8 @@ FUNC(void, OS_CODE) tpl_trace_task_terminate(
 {
   VAR(tpl_priority, AUTOMATIC) dying_task_prio;
 
-  if (tpl_stat_proc_table[dying_task_id]->type != IS_ROUTINE)
+  if ((tpl_stat_proc_table[dying_task_id]->type != IS_ROUTINE) &&
+      tpl_trace_selected(dying_task_id))
   {
 
     tpl_trace_get_date();
@@ -113,7 +180,8 @@ FUNC(void, OS_CODE) tpl_trace_task_activate(
   VAR(tpl_status, AUTOMATIC) task_old_status;
   VAR(tpl_priority, AUTOMATIC) task_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type != 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type != 0x2) &&
+      tpl_trace_selected(task_id))
   {
     tpl_trace_get_date();
 
@@ -137,7 +205,8 @@ FUNC(void, OS_CODE) tpl_trace_task_wait(
   VAR(tpl_status, AUTOMATIC) waiting_task_status;
   VAR(tpl_priority, AUTOMATIC) waiting_task_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type != 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type != 0x2) &&
+      tpl_trace_selected(waiting_task_id))
   {
     tpl_trace_get_date();
 
@@ -160,7 +229,8 @@ event_id)
   VAR(tpl_status, AUTOMATIC) released_task_status;
   VAR(tpl_priority, AUTOMATIC) released_task_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type != 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type != 0x2) &&
+      tpl_trace_selected(released_task_id))
   {
     tpl_trace_get_date();
 
@@ -182,7 +252,8 @@ FUNC(void, OS_CODE) tpl_trace_task_change_priority(
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
   VAR(tpl_priority, AUTOMATIC) priority_changing_task_new_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type != 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type != 0x2) &&
+      tpl_trace_selected(priority_changing_task_id))
   {
     tpl_trace_get_date();
     priority_changing_task_new_prio = tpl_dyn_proc_table[TPL_KERN_REF(kern).running_id]->priority;
@@ -203,27 +274,34 @@ FUNC(void, OS_CODE) tpl_trace_res_get(
   CONST(tpl_resource_id, AUTOMATIC) res_id, CONST(TaskType, AUTOMATIC) locking_entity_id)
 {
   VAR(tpl_priority, AUTOMATIC) locking_entity_prio;
-  tpl_trace_get_date();
 
-  locking_entity_prio = tpl_dyn_proc_table[locking_entity_id]->priority;
+  if (tpl_trace_selected(locking_entity_id))
+  {
+    tpl_trace_get_date();
 
-  EVENT_BEGIN(RES_GET)
-  EVENT_VALUE(res_id)
-  EVENT_VALUE(locking_entity_id)
-  EVENT_VALUE(locking_entity_prio)
-  EVENT_END()
+    locking_entity_prio = tpl_dyn_proc_table[locking_entity_id]->priority;
+
+    EVENT_BEGIN(RES_GET)
+    EVENT_VALUE(res_id)
+    EVENT_VALUE(locking_entity_id)
+    EVENT_VALUE(locking_entity_prio)
+    EVENT_END()
     FORMAT_TRACE()
+  }
 }
 
 FUNC(void, OS_CODE) tpl_trace_res_released(
   CONST(tpl_resource_id, AUTOMATIC) res_id)
 {
-  tpl_trace_get_date();
+  if (tpl_trace_sampled())
+  {
+    tpl_trace_get_date();
 
-  EVENT_BEGIN(RES_RELEASED)
-  EVENT_VALUE(res_id)
-  EVENT_END()
-  FORMAT_TRACE()
+    EVENT_BEGIN(RES_RELEASED)
+    EVENT_VALUE(res_id)
+    EVENT_END()
+    FORMAT_TRACE()
+  }
 }
 
 /**
@@ -236,7 +314,8 @@ FUNC(void, OS_CODE) tpl_trace_isr_run(
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
   VAR(tpl_priority, AUTOMATIC) running_isr_prio;
 
-  if (TPL_KERN_REF(kern).s_running->type == 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type == 0x2) &&
+      tpl_trace_selected(running_isr_id))
   {
     tpl_trace_get_date();
     running_isr_prio = tpl_dyn_proc_table[running_isr_id]->priority;
@@ -255,7 +334,8 @@ FUNC(void, OS_CODE) tpl_trace_isr_preempt(
 {
   VAR(tpl_priority, AUTOMATIC) preempted_isr_prio;
 
-  if (tpl_stat_proc_table[preempted_isr_id]->type == IS_ROUTINE)
+  if ((tpl_stat_proc_table[preempted_isr_id]->type == IS_ROUTINE) &&
+      tpl_trace_selected(preempted_isr_id))
   {
     tpl_trace_get_date();
     preempted_isr_prio = tpl_dyn_proc_table[preempted_isr_id]->priority;
@@ -273,7 +353,8 @@ FUNC(void, OS_CODE) tpl_trace_isr_terminate(
 {
   VAR(tpl_priority, AUTOMATIC) dying_isr_prio;
 
-  if (tpl_stat_proc_table[dying_isr_id]->type == IS_ROUTINE)
+  if ((tpl_stat_proc_table[dying_isr_id]->type == IS_ROUTINE) &&
+      tpl_trace_selected(dying_isr_id))
   {
     dying_isr_prio = tpl_dyn_proc_table[dying_isr_id]->priority;
     tpl_trace_get_date();
@@ -292,7 +373,8 @@ FUNC(void, OS_CODE) tpl_trace_isr_activate(
   VAR(tpl_status, AUTOMATIC) isr_old_status;
   VAR(tpl_priority, AUTOMATIC) isr_prio;
 
-  if (tpl_stat_proc_table[isr_id]->type == 0x2)
+  if ((tpl_stat_proc_table[isr_id]->type == 0x2) &&
+      tpl_trace_selected(isr_id))
   {
     tpl_trace_get_date();
     isr_old_status = tpl_dyn_proc_table[isr_id]->state;
@@ -313,7 +395,8 @@ FUNC(void, OS_CODE) tpl_trace_isr_change_priority(
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
   VAR(tpl_priority, AUTOMATIC) priority_changing_isr_new_prio;
 
-  if(TPL_KERN_REF(kern).s_running->type == 0x2)
+  if ((TPL_KERN_REF(kern).s_running->type == 0x2) &&
+      tpl_trace_selected(priority_changing_isr_id))
   {
 
     tpl_trace_get_date();
@@ -335,15 +418,18 @@ FUNC(void, OS_CODE) tpl_trace_alarm_scheduled(
   VAR(tpl_tick, AUTOMATIC) scheduled_alarm_expir_date;
   VAR(tpl_timeobj_id, TYPEDEF) scheduled_alarm_id;
 
-  tpl_trace_get_date();
-  scheduled_alarm_expir_date = scheduled_alarm->date;
-  scheduled_alarm_id = scheduled_alarm->stat_part->timeobj_id;
+  if (tpl_trace_sampled())
+  {
+    tpl_trace_get_date();
+    scheduled_alarm_expir_date = scheduled_alarm->date;
+    scheduled_alarm_id = scheduled_alarm->stat_part->timeobj_id;
 
-  EVENT_BEGIN(ALARM_SCHEDULED)
-  EVENT_VALUE(scheduled_alarm_id)
-  EVENT_VALUE(scheduled_alarm_expir_date)
-  EVENT_END()
-  FORMAT_TRACE()
+    EVENT_BEGIN(ALARM_SCHEDULED)
+    EVENT_VALUE(scheduled_alarm_id)
+    EVENT_VALUE(scheduled_alarm_expir_date)
+    EVENT_END()
+    FORMAT_TRACE()
+  }
 }
 
 FUNC(void, OS_CODE) tpl_trace_alarm_expire(
@@ -353,7 +439,8 @@ FUNC(void, OS_CODE) tpl_trace_alarm_expire(
   P2VAR(tpl_alarm_static, AUTOMATIC, OS_APPL_DATA) expired_alarm_stat;
   VAR(tpl_action_func, TYPEDEF) expired_alarm_action;
 
-  if(expired_alarm->stat_part->expire == tpl_raise_alarm){
+  /* only called by the expiry functions of the alarms */
+  if(tpl_trace_sampled()){
 
     tpl_trace_get_date();
     expired_alarm_stat = (tpl_alarm_static *)expired_alarm->stat_part;
@@ -380,13 +467,15 @@ FUNC(void, OS_CODE) tpl_trace_alarm_expire(
 FUNC(void, OS_CODE) tpl_trace_alarm_cancel(
   CONST(tpl_alarm_id, AUTOMATIC)cancelled_alarm_id)
 {
+  if (tpl_trace_sampled())
+  {
+    tpl_trace_get_date();
 
-  tpl_trace_get_date();
-
-  EVENT_BEGIN(ALARM_CANCEL)
-  EVENT_VALUE(cancelled_alarm_id)
-  EVENT_END()
+    EVENT_BEGIN(ALARM_CANCEL)
+    EVENT_VALUE(cancelled_alarm_id)
+    EVENT_END()
     FORMAT_TRACE()
+  }
 }
 
 #if ALARM_COUNT > 0
@@ -406,10 +495,13 @@ FUNC(void, OS_CODE) tpl_trace_counter(
     }
   }
 
-  EVENT_BEGIN(COUNTER_INC)
-	EVENT_VALUE(counter_id)
-	EVENT_END()
-	FORMAT_TRACE()
+  if (tpl_trace_sampled())
+  {
+    EVENT_BEGIN(COUNTER_INC)
+    EVENT_VALUE(counter_id)
+    EVENT_END()
+    FORMAT_TRACE()
+  }
 }
 #endif /* ALARM_COUNT */
 
@@ -432,5 +524,102 @@ FUNC(void, OS_CODE) tpl_trace_tpl_terminate()
   FORMAT_TRACE()
 }
 
+/**
+* CONTROL FUNCTIONS
+*/
+
+FUNC(void, OS_CODE) tpl_trace_set_control(
+  CONSTP2CONST(tpl_trace_control, AUTOMATIC, OS_VAR) control)
+{
+  tpl_trace_ctrl = *control;
+  tpl_trace_ctrl.countdown = 0;
+}
+
+FUNC(tpl_status, OS_CODE) tpl_set_trace_filter_service(
+  CONST(uint32, AUTOMATIC)  classes,
+  CONST(uint32, AUTOMATIC)  sampling)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_SetTraceFilter)
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    tpl_trace_ctrl.classes = classes;
+    tpl_trace_ctrl.sampling = sampling;
+    tpl_trace_ctrl.countdown = 0;
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+FUNC(tpl_status, OS_CODE) tpl_set_trace_proc_service(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id,
+  CONST(tpl_bool, AUTOMATIC)    traced)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  VAR(uint32, AUTOMATIC) word;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  /*  store information for error hook routine    */
+  STORE_SERVICE(OSServiceId_SetTraceProc)
+  STORE_TASK_ID(proc_id)
+
+#if WITH_OS_EXTENDED == YES
+  if ((proc_id != TRACE_ALL_PROCS) &&
+      ((uint32)proc_id >= (TASK_COUNT + ISR_COUNT)))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    if (proc_id == TRACE_ALL_PROCS)
+    {
+      for (word = 0; word < TPL_TRACE_PROC_WORDS; word++)
+      {
+        tpl_trace_ctrl.masked_procs[word] = (traced ? 0 : (uint32)0xFFFFFFFF);
+      }
+    }
+    else
+    {
+      word = (uint32)proc_id >> 5;
+      if (traced)
+      {
+        tpl_trace_ctrl.masked_procs[word] &=
+          ~((uint32)1 << ((uint32)proc_id & 31));
+      }
+      else
+      {
+        tpl_trace_ctrl.masked_procs[word] |=
+          (uint32)1 << ((uint32)proc_id & 31);
+      }
+    }
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
+
+#endif /* WITH_TRACE */
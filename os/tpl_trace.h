@@ -29,37 +29,12 @@
 #include "tpl_os_types.h"
 #include "tpl_os_kernel.h"
 #include "tpl_os_timeobj_kernel.h"
+#include "tpl_os_trace.h"
 
 #if WITH_TRACE == YES
 #include "tpl_target_trace.h"
 #endif
 
-/**
-* @def IDs of the different traces
-*/
-
-#define TASK_RUN 0
-#define TASK_PREEMPT 1
-#define TASK_TERMINATE 2
-#define TASK_ACTIVATE 3
-#define TASK_WAIT 4
-#define TASK_RELEASED 5
-#define TASK_CHANGE_PRIORITY 6
-#define RES_GET 7
-#define RES_RELEASED 8
-#define ISR_RUN 9
-#define ISR_PREEMPT 10
-#define ISR_TERMINATE 11
-#define ISR_ACTIVATE 12
-#define ISR_CHANGE_PRIORITY 13
-#define ALARM_SCHEDULED 14
-#define ALARM_EXPIRE 15
-#define ALARM_CANCEL 16
-#define USER_EVENT 17
-#define TPL_INIT 18
-#define TPL_TERMINATE 19
-#define COUNTER_INC 20
-
 /* define the alarm actions */
 
 #define TRACE_CALLBACK 0
@@ -70,6 +45,52 @@
 
 #if WITH_TRACE == YES
 
+/**
+ * @def TPL_TRACE_PROC_WORDS
+ *
+ * Number of words of the bitmap of the filtered out processes
+ */
+#define TPL_TRACE_PROC_WORDS  (((TASK_COUNT + ISR_COUNT) / 32) + 1)
+
+/**
+ * @internal
+ *
+ * Runtime trace control:
+ * - classes has a bit per trace id (see #TRACE_CLASS), an event whose bit
+ *   is clear costs a test of this word;
+ * - masked_procs has a bit per task and ISR2 whose events are filtered
+ *   out;
+ * - one event out of sampling that pass the filters is recorded, 0 and 1
+ *   record all of them. countdown counts the events until the next one.
+ */
+typedef struct {
+  uint32  classes;
+  uint32  sampling;
+  uint32  countdown;
+  uint32  masked_procs[TPL_TRACE_PROC_WORDS];
+} tpl_trace_control;
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+extern VAR(tpl_trace_control, OS_VAR) tpl_trace_ctrl;
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/**
+ * @def TRACE_ON
+ *
+ * The events trace_id are recorded
+ */
+#define TRACE_ON(trace_id) \
+  ((tpl_trace_ctrl.classes & TRACE_CLASS(trace_id)) != 0)
+
+/*
+ * Each TRACE_* hook is a single statement (do { } while (0)) and is
+ * followed by a semicolon where it is used.
+ */
+
 /**
 *  functions tracing the tasks sheduling
 */
@@ -78,43 +99,43 @@
 /**
 * @def TRACE_TASK_EXECUTE
 */
-#		define TRACE_TASK_EXECUTE(new_executed_task_id) \
-		tpl_trace_task_execute(new_executed_task_id);
+#		define TRACE_TASK_EXECUTE(new_executed_task_id)\
+		do { if (TRACE_ON(TASK_RUN)) { tpl_trace_task_execute(new_executed_task_id); } } while (0)
 
 /**
 * @def TRACE_TASK_PREEMPT
 */
 #		define TRACE_TASK_PREEMPT(preempted_task_id)\
-		tpl_trace_task_preempt(preempted_task_id);
+		do { if (TRACE_ON(TASK_PREEMPT)) { tpl_trace_task_preempt(preempted_task_id); } } while (0)
 
 /**
 * @def TRACE_TASK_TERMINATE
 */
 #		define TRACE_TASK_TERMINATE(dying_task_id)\
-		tpl_trace_task_terminate(dying_task_id);
+		do { if (TRACE_ON(TASK_TERMINATE)) { tpl_trace_task_terminate(dying_task_id); } } while (0)
 
 /**
 * @def TRACE_TASK_ACTIVATE
 */
 #		define TRACE_TASK_ACTIVATE(task_id)\
-		tpl_trace_task_activate(task_id);
+		do { if (TRACE_ON(TASK_ACTIVATE)) { tpl_trace_task_activate(task_id); } } while (0)
 /**
 * @def TRACE_TASK_WAIT
 */
 #		define TRACE_TASK_WAIT(waiting_task_id)\
-		tpl_trace_task_wait(waiting_task_id);
+		do { if (TRACE_ON(TASK_WAIT)) { tpl_trace_task_wait(waiting_task_id); } } while (0)
 
 /**
 * @def TRACE_TASK_RELEASED
 */
 #		define TRACE_TASK_RELEASED(released_task_id, event_id)\
-		tpl_trace_task_released(released_task_id, event_id);
+		do { if (TRACE_ON(TASK_RELEASED)) { tpl_trace_task_released(released_task_id, event_id); } } while (0)
 
 /**
 * @def TRACE_TASK_CHANGE_PRIORITY
 */
 #		define TRACE_TASK_CHANGE_PRIORITY(priority_changing_task_id)\
-		tpl_trace_task_change_priority(priority_changing_task_id);
+		do { if (TRACE_ON(TASK_CHANGE_PRIORITY)) { tpl_trace_task_change_priority(priority_changing_task_id); } } while (0)
 
 
 #	else
@@ -136,17 +157,17 @@
 * @def TRACE_RES_GET
 */
 #		define TRACE_RES_GET(res_id, locking_entity_id)\
-		tpl_trace_res_get(res_id, locking_entity_id);
+		do { if (TRACE_ON(RES_GET)) { tpl_trace_res_get(res_id, locking_entity_id); } } while (0)
 
 /**
 * @def TRACE_RES_RELEASE
 */
 #		define TRACE_RES_RELEASED(res_id)\
-		tpl_trace_res_released(res_id);
+		do { if (TRACE_ON(RES_RELEASED)) { tpl_trace_res_released(res_id); } } while (0)
 
 #	else
 #		define TRACE_RES_GET(res_id, locking_entity_id)
-#		define TRACE_RES_RELEASED(res_id);
+#		define TRACE_RES_RELEASED(res_id)
 #	endif
 
 /**
@@ -158,31 +179,31 @@
 * @def TRACE_ISR_RUN
 */
 #		define TRACE_ISR_RUN(running_isr_id)\
-		tpl_trace_isr_run(running_isr_id);
+		do { if (TRACE_ON(ISR_RUN)) { tpl_trace_isr_run(running_isr_id); } } while (0)
 
 /**
 * @def TRACE_ISR_PREEMPT
 */
 #		define TRACE_ISR_PREEMPT(prempted_isr_id)\
-		tpl_trace_isr_preempt(prempted_isr_id);
+		do { if (TRACE_ON(ISR_PREEMPT)) { tpl_trace_isr_preempt(prempted_isr_id); } } while (0)
 
 /**
 * @def TRACE_ISR_TERMINATE
 */
 #		define TRACE_ISR_TERMINATE(dying_isr_id)\
-		tpl_trace_isr_terminate(dying_isr_id);
+		do { if (TRACE_ON(ISR_TERMINATE)) { tpl_trace_isr_terminate(dying_isr_id); } } while (0)
 
 /**
 * @def TRACE_ISR_ACTIVATE
 */
 #		define TRACE_ISR_ACTIVATE(isr_id)\
-		tpl_trace_isr_activate(isr_id);
+		do { if (TRACE_ON(ISR_ACTIVATE)) { tpl_trace_isr_activate(isr_id); } } while (0)
 
 /**
 * @def TRACE_ISR_CHANGE_PRIORITY
 */
 #		define TRACE_ISR_CHANGE_PRIORITY(priority_changing_isr_id)\
-		tpl_trace_isr_change_priority(priority_changing_isr_id);
+		do { if (TRACE_ON(ISR_CHANGE_PRIORITY)) { tpl_trace_isr_change_priority(priority_changing_isr_id); } } while (0)
 
  #	else
 #		define TRACE_ISR_RUN(running_isr_id)
@@ -203,26 +224,26 @@
 * @def TRACE_ALARM_SCHEDULED
 */
 #		define TRACE_ALARM_SCHEDULED(scheduled_alarm)\
-		tpl_trace_alarm_scheduled(scheduled_alarm);
+		do { if (TRACE_ON(ALARM_SCHEDULED)) { tpl_trace_alarm_scheduled(scheduled_alarm); } } while (0)
 
 /**
 * @def TRACE_ALARM_EXPIRE
 */
 #		define TRACE_ALARM_EXPIRE(expired_alarm)\
-		tpl_trace_alarm_expire(expired_alarm);
+		do { if (TRACE_ON(ALARM_EXPIRE)) { tpl_trace_alarm_expire(expired_alarm); } } while (0)
 
 /**
 * @def TRACE_ALARM_CANCEL
 */
 #		define TRACE_ALARM_CANCEL(cancelled_alarm_id)\
-		tpl_trace_alarm_cancel(cancelled_alarm_id);
+		do { if (TRACE_ON(ALARM_CANCEL)) { tpl_trace_alarm_cancel(cancelled_alarm_id); } } while (0)
 
 #	  if (ALARM_COUNT > 0)
 /**
  * @def TRACE_COUNTER
  */
 #       define TRACE_COUNTER(counter_desc)\
-        tpl_trace_counter(counter_desc);
+        do { if (TRACE_ON(COUNTER_INC)) { tpl_trace_counter(counter_desc); } } while (0)
 #	  else
 #       define TRACE_COUNTER(counter_desc)
 #	  endif
@@ -243,7 +264,7 @@
 * @def TRACE_USER_EVENT
 */
 #		define TRACE_USER_EVENT(event_id)\
-		tpl_trace_user_event(event_id);
+		do { if (TRACE_ON(USER_EVENT)) { tpl_trace_user_event(event_id); } } while (0)
 #	else
 #		define TRACE_USER_EVENT(event_id)
 #	endif
@@ -252,13 +273,13 @@
 * @def TRACE_TPL_INIT
 */
 #	define TRACE_TPL_INIT()\
-	tpl_trace_tpl_init();
+	do { tpl_trace_tpl_init(); } while (0)
 
 /**
 * @def TRACE_TPL_TERMINATE
 */
 #	define TRACE_TPL_TERMINATE()\
-	tpl_trace_tpl_terminate();
+	do { tpl_trace_tpl_terminate(); } while (0)
 
 #else
 #	define TRACE_TPL_INIT()
@@ -281,7 +302,7 @@
 #	define TRACE_ALARM_EXPIRE(expired_alarm)
 #	define TRACE_ALARM_CANCEL(cancelled_alarm_id)
 #   define TRACE_COUNTER(counter_desc)
-#	define TRACE_U_EVENT(event_id)
+#	define TRACE_USER_EVENT(event_id)
 #endif
 
 #define OS_START_SEC_CODE
@@ -471,6 +492,47 @@ FUNC(void, OS_CODE) tpl_trace_tpl_init();
 
 FUNC(void, OS_CODE) tpl_trace_tpl_terminate();
 
+#if WITH_TRACE == YES
+/**
+ * @internal
+ *
+ * Service SetTraceFilter: sets the trace ids recorded and the sampling
+ *
+ * @param classes   a bit per trace id (see #TRACE_CLASS)
+ * @param sampling  one event out of sampling is recorded, 0 or 1 for all
+ *
+ * @retval  E_OK    no error
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_trace_filter_service(
+  CONST(uint32, AUTOMATIC)  classes,
+  CONST(uint32, AUTOMATIC)  sampling);
+
+/**
+ * @internal
+ *
+ * Service SetTraceProc: selects or filters out the events of a task or
+ * of an ISR2
+ *
+ * @param proc_id   the task or the ISR2, or TRACE_ALL_PROCS
+ * @param traced    TRUE to record its events
+ *
+ * @retval  E_OK    no error
+ * @retval  E_OS_ID proc_id is invalid (extended error)
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_trace_proc_service(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id,
+  CONST(tpl_bool, AUTOMATIC)    traced);
+
+/**
+ * @internal
+ *
+ * Replaces the classes, the sampling and the filtered out processes, for
+ * a machine that gets them from the host
+ */
+FUNC(void, OS_CODE) tpl_trace_set_control(
+  CONSTP2CONST(tpl_trace_control, AUTOMATIC, OS_VAR) control);
+#endif
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
@@ -0,0 +1,82 @@
+/**
+ * @file semaphores_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+
+/*test case:test the reaction of the system when a task that does not
+hold the semaphore posts it*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = SemWait(sem);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,E_OK, result_inst_1);
+	
+	/* t3 blocks on sem, t1 inherits its priority */
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_2 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,E_OK, result_inst_2);
+	
+	/* t2 does not preempt t1 which has the priority of t3 */
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_3 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OK, result_inst_3);
+	
+	/* t4 posts sem: t3 takes it and t1 gets back its priority, so t3
+	   then t2 run before t1 */
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_4 = ActivateTask(t4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(10,E_OK, result_inst_4);
+
+}
+
+/*create the test suite with all the test cases*/
+TestRef SemaphoreTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(SemaphoreTest,"SemaphoreTest_sequence1",NULL,NULL,fixtures);
+
+	return (TestRef)&SemaphoreTest;
+}
+
+/* End of file semaphores_s1/task1_instance.c */
@@ -0,0 +1,72 @@
+/**
+ * @file semaphores_s1/task3_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t3*/
+
+#include "tpl_os.h"
+
+/*test case:test the reaction of the system when a task that does not
+hold the semaphore posts it*/
+static void test_t3_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3;
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_1 = SemWait(sem);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_1);
+	
+	/* the post of the new holder does not lower t3 to the priority t1
+	   had before it inherited, so t2 does not preempt t3 */
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_2 = SemPost(sem);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_3 = TerminateTask();
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,E_OK, result_inst_3);
+
+}
+
+/*create the test suite with all the test cases*/
+TestRef SemaphoreTest_seq1_t3_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t3_instance",test_t3_instance)
+	};
+	EMB_UNIT_TESTCALLER(SemaphoreTest,"SemaphoreTest_sequence1",NULL,NULL,fixtures);
+
+	return (TestRef)&SemaphoreTest;
+}
+
+/* End of file semaphores_s1/task3_instance.c */
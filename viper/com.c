@@ -131,6 +131,14 @@ void read_command(vp_command *o_com)
     
     viper_log("Got command");
     
+	/*  the application waits for the answer to ADVANCE  */
+	if (o_com->command != ADVANCE) {
+		reply_command();
+	}
+}
+
+void reply_command(void)
+{
 	if (sem_post(w_com_sem) < 0) {
 		perror("viper: fail while posting writer semaphore");
 	}
@@ -15,5 +15,6 @@
 void init_com(void);
 void close_com(void);
 void read_command(vp_command *);
+void reply_command(void);
 
 #endif
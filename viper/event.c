@@ -0,0 +1,222 @@
+/*
+ *  event.c
+ *  viper
+ *
+ *  Replay of an event file.
+ *
+ *  The file is mapped in memory and each record is sent at its date
+ *  counted from the start of the replay. The dates are absolute
+ *  deadlines so the lateness of an event does not shift the next ones.
+ *
+ */
+
+#include "event.h"
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define NSEC_PER_SEC 1000000000ULL
+
+extern pid_t osek_app_pid;
+
+void viper_log(const char *);
+void *event_thread(void *);
+
+static uint64_t event_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+/*
+ * event_sleep_until waits until the date (CLOCK_MONOTONIC, in ns).
+ * It returns at once when the date is over.
+ */
+static void event_sleep_until(uint64_t date)
+{
+	uint64_t now = event_now();
+	if (now < date) {
+#ifdef DARWIN
+		struct timespec ts;
+		ts.tv_sec = (time_t)((date - now) / NSEC_PER_SEC);
+		ts.tv_nsec = (long)((date - now) % NSEC_PER_SEC);
+		while (nanosleep(&ts, &ts) < 0 && errno == EINTR);
+#else
+		struct timespec ts;
+		ts.tv_sec = (time_t)(date / NSEC_PER_SEC);
+		ts.tv_nsec = (long)(date % NSEC_PER_SEC);
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+#endif
+	}
+}
+
+/*
+ * vp_map_event_file maps the event file and checks its header. It
+ * returns the first record or NULL.
+ */
+const vp_event_record *vp_map_event_file(
+	const char *file_name, void **map, size_t *map_size, uint64_t *count)
+{
+	char msg[512];
+	const vp_event_header *header;
+	struct stat st;
+	int fd = open(file_name, O_RDONLY);
+	
+	if (fd < 0) {
+		snprintf(msg, sizeof(msg), "Event: cannot open %s", file_name);
+		viper_log(msg);
+		return NULL;
+	}
+	if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(vp_event_header)) {
+		snprintf(msg, sizeof(msg), "Event: %s is not an event file", file_name);
+		viper_log(msg);
+		close(fd);
+		return NULL;
+	}
+	*map_size = (size_t)st.st_size;
+	*map = mmap(NULL, *map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (*map == MAP_FAILED) {
+		snprintf(msg, sizeof(msg), "Event: cannot map %s", file_name);
+		viper_log(msg);
+		return NULL;
+	}
+	
+	header = (const vp_event_header *)*map;
+	*count = (*map_size - sizeof(vp_event_header)) / sizeof(vp_event_record);
+	if (header->magic != VP_EVENT_MAGIC ||
+	    header->version != VP_EVENT_VERSION ||
+	    (header->count != VP_EVENT_UNTIL_EOF && header->count > *count)) {
+		snprintf(msg, sizeof(msg), "Event: %s is not an event file", file_name);
+		viper_log(msg);
+		munmap(*map, *map_size);
+		return NULL;
+	}
+	/*  the records are read once, in order */
+	posix_madvise(*map, *map_size, POSIX_MADV_SEQUENTIAL);
+	if (header->count != VP_EVENT_UNTIL_EOF) {
+		*count = header->count;
+	}
+	
+	return (const vp_event_record *)(header + 1);
+}
+
+void *event_thread(void *args)
+{
+	vp_event_param *param = (vp_event_param *)args;
+	const uint64_t tolerance = (uint64_t)param->tolerance * 1000;
+	const vp_event_record *record;
+	void *map;
+	size_t map_size;
+	uint64_t count, i, start, deadline, now, late;
+	uint64_t sent = 0, missed = 0, dropped = 0, max_late = 0;
+	char msg[512];
+	
+	record = vp_map_event_file(param->file_name, &map, &map_size, &count);
+	if (record == NULL) {
+		pthread_exit(NULL);
+		return NULL;
+	}
+	
+	start = event_now();
+	now = start;
+	for (i = 0; i < count; i++, record++) {
+		int result;
+		deadline = start + record->date;
+		event_sleep_until(deadline);
+		
+		if (record->line == NO_LINE) {
+			result = kill(osek_app_pid,
+			              record->payload != 0 ? (int)record->payload : param->sig);
+		}
+		else if (record->line >= 0 &&
+		         record->line < VP_EVENT_LINE_COUNT &&
+		         param->line_signal[record->line] != VP_NO_SIGNAL) {
+			union sigval value;
+			value.sival_int = (int)(((record->payload & VP_LINE_MASK) << VP_PAYLOAD_SHIFT) |
+			                        ((uint32_t)record->line & VP_LINE_MASK));
+			result = sigqueue(osek_app_pid,
+			                  SIGRTMIN + param->line_signal[record->line],
+			                  value);
+		}
+		else {
+			if (record->line < 0 || record->line >= VP_EVENT_LINE_COUNT) {
+				snprintf(msg, sizeof(msg),
+				         "Event: record %llu rejected, line %d out of 0..%d",
+				         (unsigned long long)i, (int)record->line,
+				         VP_EVENT_LINE_COUNT - 1);
+			}
+			else {
+				snprintf(msg, sizeof(msg), "Event: no signal for line %d", (int)record->line);
+			}
+			viper_log(msg);
+			errno = EINVAL;
+			result = -1;
+		}
+		
+		now = event_now();
+		if (result < 0) {
+			/*  the application left or its queue of signals is full  */
+			if (errno == ESRCH) break;
+			dropped++;
+			continue;
+		}
+		sent++;
+		late = now > deadline ? now - deadline : 0;
+		if (late > max_late) max_late = late;
+		if (late > tolerance) missed++;
+	}
+	
+	munmap(map, map_size);
+	
+	snprintf(msg, sizeof(msg),
+	         "Event: %s: %llu/%llu events sent, %llu dropped, %llu missed "
+	         "their deadline by more than %lu us, max lateness %llu us, "
+	         "%.0f events/s",
+	         param->file_name,
+	         (unsigned long long)sent, (unsigned long long)count,
+	         (unsigned long long)dropped, (unsigned long long)missed,
+	         param->tolerance, (unsigned long long)(max_late / 1000),
+	         now > start ? (double)sent * NSEC_PER_SEC / (double)(now - start) : 0.0);
+	viper_log(msg);
+	fprintf(stderr, "viper: %s\n", msg);
+	
+	pthread_exit(NULL);
+	return NULL;
+}
+
+/*
+ * vp_create_event alloc an event replay data structure
+ * The replay is not started
+ */
+vp_event *vp_create_event(const vp_event_param *param)
+{
+	vp_event *event = malloc(sizeof(vp_event));
+	
+	if (event != NULL) {
+		/*  alloc was successful, init the ev struct	*/
+		memcpy(&(event->ev), param, sizeof(vp_event_param));
+		event->ev.file_name[sizeof(event->ev.file_name) - 1] = '\0';
+	}
+	
+	return event;
+}
+
+/*
+ * vp_start_event starts the replay
+ */
+int vp_start_event(vp_event *event)
+{
+	int result;
+	
+	result = pthread_create(&(event->th),NULL,event_thread,&(event->ev));
+	return result;
+}
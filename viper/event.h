@@ -0,0 +1,40 @@
+/*
+ *  event.h
+ *  viper
+ *
+ *  Replay of an event file.
+ *
+ */
+
+#ifndef __EVENT_H__
+#define __EVENT_H__
+
+#include "viper.h"
+#include <pthread.h>
+
+struct VP_EVENT {
+	vp_event_param  ev;
+	pthread_t		th;
+};
+
+typedef struct VP_EVENT vp_event;
+
+/*
+ * vp_map_event_file maps an event file and checks its header. It
+ * returns the first record or NULL and gives the mapping to unmap.
+ */
+const vp_event_record *vp_map_event_file(
+	const char *file_name, void **map, size_t *map_size, uint64_t *count);
+
+/*
+ * vp_create_event alloc an event replay data structure
+ * The replay is not started
+ */
+vp_event *vp_create_event(const vp_event_param *param);
+
+/*
+ * vp_start_event starts the replay
+ */
+int vp_start_event(vp_event *event);
+
+#endif
@@ -9,18 +9,43 @@
 
 #include "exec.h"
 #include "timer.h"
+#include "event.h"
+#include "virtual.h"
+#include "com.h"
 #include "unistd.h"
 
 void exec_timer(vp_timer_param *);
+void exec_event(vp_event_param *);
 void exec_shutdown(void);
 
 void exec_timer(vp_timer_param *t_p)
 {
+	if (vp_virtual_mode()) {
+		vp_virtual_add_timer(t_p);
+		return;
+	}
+	
 	/*  launches the thread of the time */
-	vp_timer *timer = vp_create_timer(t_p->type,t_p->delay,t_p->sig);
+	vp_timer *timer = vp_create_timer(t_p->type,t_p->delay,t_p->sig,t_p->line);
 	vp_start_timer(timer);
 }
 
+void exec_event(vp_event_param *e_p)
+{
+	vp_event *event;
+	
+	if (vp_virtual_mode()) {
+		vp_virtual_add_event(e_p);
+		return;
+	}
+	
+	/*  launches the thread that replays the event file */
+	event = vp_create_event(e_p);
+	if (event != NULL) {
+		vp_start_event(event);
+	}
+}
+
 void exec_shutdown(void)
 {
 }
@@ -29,6 +54,9 @@ void exec_command(vp_command *i_com)
 {
 	switch (i_com->command) {
 		case TIMER: exec_timer(&(i_com->params.timer)); break;
+		case EVENT: exec_event(&(i_com->params.event)); break;
+		case VTIME: vp_virtual_init(&(i_com->params.vtime)); break;
+		case ADVANCE: vp_virtual_advance(); reply_command(); break;
 		case PWROF: exec_shutdown(); break;
 	}
 }
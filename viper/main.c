@@ -10,6 +10,7 @@
 #include "exec.h"
 #include "log.h"
 #include "control.h"
+#include "trace.h"
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -36,12 +37,17 @@ int main (int argc, const char *argv[]) {
     
     /*  init motors */
     init_motors();
+
+    /*  init the trace control from the host    */
+    init_trace_control();
     
     do {
         read_command(&command);
         exec_command(&command);
     } while (command.command != PWROF);
 
+    close_trace_control();
+
     close_motors();
     
 	close_com();
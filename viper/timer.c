@@ -23,12 +23,21 @@ void *timer_thread(void *args)
 	int type = ((vp_timer_param *)args)->type;
 	useconds_t delay = ((vp_timer_param *)args)->delay;
 	int sig = ((vp_timer_param *)args)->sig;
+	int line = ((vp_timer_param *)args)->line;
+	union sigval value;
+	value.sival_int = line;
 	while(1) {
 		if (usleep(delay) != 0) {
             viper_log("Timer failed");
 			break;
 		}
-		kill(osek_app_pid,sig);
+		if (line == NO_LINE) {
+			kill(osek_app_pid,sig);
+		}
+		else {
+			/*  real time signal, the payload is the interrupt line  */
+			sigqueue(osek_app_pid,sig,value);
+		}
 /*        viper_log("Sending interrupt"); */
 		if (type == ONE_SHOT) {
 			break;
@@ -42,7 +51,7 @@ void *timer_thread(void *args)
  * vp_create_timer alloc a timer data structure
  * The timer is not started
  */
-vp_timer *vp_create_timer(int type, useconds_t delay, int sig)
+vp_timer *vp_create_timer(int type, useconds_t delay, int sig, int line)
 {
 	vp_timer *timer = malloc(sizeof(vp_timer));
 	
@@ -51,6 +60,7 @@ vp_timer *vp_create_timer(int type, useconds_t delay, int sig)
 		timer->tm.type = type;
 		timer->tm.delay = delay;
 		timer->tm.sig = sig;
+		timer->tm.line = line;
 	}
 	
 	return timer;
@@ -25,7 +25,7 @@ typedef struct VP_TIMER vp_timer;
  * vp_create_timer alloc a timer data structure
  * The timer is not started
  */
-vp_timer *vp_create_timer(int type, useconds_t delay, int sig);
+vp_timer *vp_create_timer(int type, useconds_t delay, int sig, int line);
 
 /*
  * vp_start_timer starts the timer
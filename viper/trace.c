@@ -0,0 +1,154 @@
+/*
+ *  trace.c
+ *  viper
+ *
+ *  Trace control from the host. viper creates the FIFO
+ *  /tmp/viper.trace.<pid of the application> and reads commands from it,
+ *  one per line:
+ *
+ *    classes <mask>        trace ids recorded, a bit per id, or all or none
+ *    sample <n>            one event out of n is recorded
+ *    proc <id> on|off      records or filters out a task or an ISR2
+ *    procs on|off          records or filters out all of them
+ *
+ *  for instance: echo "classes 0x1f" > /tmp/viper.trace.1234
+ *
+ *  The filter of the host starts with all the classes, no sampling and
+ *  all the processes, and the first command replaces the one the
+ *  application uses. The application reads it at each tick of its
+ *  counters.
+ */
+
+#include "trace.h"
+#include "viper.h"
+
+#include <sys/stat.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+extern vp_ctrl *ctrl;
+extern pid_t osek_app_pid;
+
+void viper_log(char *);
+
+static char trace_fifo_path[32];
+static pthread_t trace_thread;
+static vp_trace_ctrl host_trace = {
+    0,              /*  seq             */
+    0xFFFFFFFF,     /*  classes         */
+    1,              /*  sampling        */
+    { 0 }           /*  masked_procs    */
+};
+
+/*
+ * publish copies the filter of the host in the shared memory
+ */
+static void publish(void)
+{
+    vp_trace_ctrl *shared = &ctrl->trace;
+
+    shared->seq++;
+    __sync_synchronize();
+    shared->classes = host_trace.classes;
+    shared->sampling = host_trace.sampling;
+    memcpy(shared->masked_procs, host_trace.masked_procs,
+           sizeof(host_trace.masked_procs));
+    __sync_synchronize();
+    shared->seq++;
+}
+
+static int parse_command(char *line)
+{
+    char keyword[16];
+    char arg[32];
+    char state[8];
+    unsigned long id;
+    int words = sscanf(line, "%15s %31s %7s", keyword, arg, state);
+
+    if (words >= 2 && strcmp(keyword, "classes") == 0) {
+        if (strcmp(arg, "all") == 0) {
+            host_trace.classes = 0xFFFFFFFF;
+        }
+        else if (strcmp(arg, "none") == 0) {
+            host_trace.classes = 0;
+        }
+        else {
+            host_trace.classes = (uint32_t)strtoul(arg, NULL, 0);
+        }
+    }
+    else if (words >= 2 && strcmp(keyword, "sample") == 0) {
+        host_trace.sampling = (uint32_t)strtoul(arg, NULL, 0);
+    }
+    else if (words >= 2 && strcmp(keyword, "procs") == 0) {
+        memset(host_trace.masked_procs,
+               strcmp(arg, "off") == 0 ? 0xFF : 0,
+               sizeof(host_trace.masked_procs));
+    }
+    else if (words == 3 && strcmp(keyword, "proc") == 0) {
+        id = strtoul(arg, NULL, 0);
+        if (id >= 32 * VP_TRACE_PROC_WORDS) {
+            return 0;
+        }
+        if (strcmp(state, "off") == 0) {
+            host_trace.masked_procs[id / 32] |= (uint32_t)1 << (id % 32);
+        }
+        else {
+            host_trace.masked_procs[id / 32] &= ~((uint32_t)1 << (id % 32));
+        }
+    }
+    else {
+        return 0;
+    }
+    return 1;
+}
+
+static void *trace_control_thread(void *unused)
+{
+    char line[80];
+    char msg[128];
+    FILE *fifo;
+
+    (void)unused;
+    /*  opened for writing too, so the FIFO is not at EOF between writers */
+    fifo = fopen(trace_fifo_path, "r+");
+
+    if (fifo == NULL) {
+        perror("viper: unable to open the trace control FIFO");
+        return NULL;
+    }
+    while (fgets(line, sizeof(line), fifo) != NULL) {
+        if (parse_command(line)) {
+            publish();
+            snprintf(msg, sizeof(msg), "Trace control: %s", line);
+        }
+        else {
+            snprintf(msg, sizeof(msg), "Bad trace control command: %s", line);
+        }
+        msg[strcspn(msg, "\n")] = '\0';
+        viper_log(msg);
+    }
+    fclose(fifo);
+    return NULL;
+}
+
+void init_trace_control(void)
+{
+    sprintf(trace_fifo_path, TRACE_FIFO_PATH, osek_app_pid);
+    unlink(trace_fifo_path);
+    if (mkfifo(trace_fifo_path, S_IRUSR | S_IWUSR) < 0) {
+        perror("viper: unable to create the trace control FIFO");
+        return;
+    }
+    viper_log("Trace control FIFO created");
+    pthread_create(&trace_thread, NULL, trace_control_thread, NULL);
+    pthread_detach(trace_thread);
+}
+
+void close_trace_control(void)
+{
+    unlink(trace_fifo_path);
+}
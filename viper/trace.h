@@ -0,0 +1,15 @@
+/*
+ *  trace.h
+ *  viper
+ *
+ *  Trace control from the host
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+void init_trace_control(void);
+void close_trace_control(void);
+
+#endif
@@ -16,6 +16,7 @@
 #endif
 #include <unistd.h>
 #include <sys/types.h>
+#include <stdint.h>
 
 #define DATA_FILE_PATH  "/viper.data.%d"
 #define CTRL_FILE_PATH  "/viper.ctrl.%d"
@@ -23,34 +24,107 @@
 #define R_SEM_FILE_PATH "/viper.rsem.%d"
 #define W_SEM_FILE_PATH "/viper.wsem.%d"
 #define SYNCHRO_SEM_FILE_PATH "/viper.wsem.%d"
+#define TRACE_FIFO_PATH "/tmp/viper.trace.%d"
 
 #define HELLO   0
 #define TIMER   1
 #define PWROF   2
+#define EVENT   3
+#define VTIME   4
+#define ADVANCE 5
 
 #define ONE_SHOT	0
 #define AUTO		1
 
+/*  line of a timer that sends a classic signal   */
+#define NO_LINE   -1
+
 struct VP_TIMER_PARAM {
 	int            type;  /*  ONE_SHOT or AUTO					*/
 	unsigned long  delay; /*  delay of the timer in microseconds  */
 	int            sig;   /*  signal to send						*/
+	int            line;  /*  interrupt line sent with sigqueue or NO_LINE */
 };
 
+/*
+ * number of interrupt lines an event file may raise. goil limits the
+ * LINE of an RTSIG interrupt source to the same range. A record with a
+ * line out of this range is rejected and logged.
+ */
+#define VP_EVENT_LINE_COUNT 256
+/*  line_signal of a line that has no real time signal  */
+#define VP_NO_SIGNAL        0xFF
+
 struct VP_EVENT_PARAM {
     char file_name[256];    /*  File where the events are stored    */
     int  sig;               /*  Signal to send                      */
+    unsigned long tolerance;    /*  lateness in microseconds above which
+                                    an event misses its deadline        */
+    unsigned char line_signal[VP_EVENT_LINE_COUNT];
+                            /*  real time signal of each line, as an
+                                offset from SIGRTMIN, or VP_NO_SIGNAL   */
+};
+
+/*
+ * An event file is a header followed by records sorted by date. It is
+ * written in the byte order of the host. A count of VP_EVENT_UNTIL_EOF
+ * means the records go up to the end of the file.
+ */
+#define VP_EVENT_MAGIC      0x56504556  /*  "VPEV"  */
+#define VP_EVENT_VERSION    1
+#define VP_EVENT_UNTIL_EOF  ((uint64_t)-1)
+
+struct VP_EVENT_HEADER {
+    uint32_t magic;         /*  VP_EVENT_MAGIC                      */
+    uint32_t version;       /*  VP_EVENT_VERSION                    */
+    uint64_t count;         /*  number of records                   */
 };
 
+/*
+ * An event with a line is sent with sigqueue. The value is the line in
+ * the low 16 bits and the low 16 bits of the payload in the high 16
+ * bits. An event with NO_LINE carries no payload to the application:
+ * its payload field is the signal sent with kill or, when it is 0, the
+ * sig of the command.
+ */
+struct VP_EVENT_RECORD {
+    uint64_t date;          /*  nanoseconds from the start of the replay */
+    int32_t  line;          /*  interrupt line or NO_LINE           */
+    uint32_t payload;       /*  payload, or signal for NO_LINE      */
+};
+
+#define VP_LINE_MASK        0xFFFF
+#define VP_PAYLOAD_SHIFT    16
+
+typedef struct VP_EVENT_HEADER vp_event_header;
+typedef struct VP_EVENT_RECORD vp_event_record;
+
 typedef struct VP_TIMER_PARAM vp_timer_param;
 typedef struct VP_EVENT_PARAM vp_event_param;
 
+/*
+ * In virtual time, viper does not wait: when the application is idle
+ * it sends ADVANCE and viper moves the virtual date to the next timer or
+ * event. The events of the same date are sent in the order they were
+ * programmed or, when seed is not 0, in an order drawn from the seed.
+ * The events sent are written in log_file, an event file that replay
+ * plays back instead of the timers and events of the application.
+ */
+struct VP_VTIME_PARAM {
+    unsigned long   seed;
+    char            log_file[256];  /*  "" for no log                   */
+    vp_event_param  replay;         /*  file_name is "" for no replay   */
+};
+
+typedef struct VP_VTIME_PARAM vp_vtime_param;
+
 struct VP_COMMAND
 {
 	int command;	/* command to execute by viper  */
 	union {
 		vp_event_param  event;
 		vp_timer_param  timer;
+		vp_vtime_param  vtime;
 	}   params;
 };
 
@@ -60,16 +134,49 @@ typedef struct VP_COMMAND vp_command;
 #define MOTOR_CSG_LEFT 1
 #define MOTOR_CSG_RGHT 2
 
+/*
+ * Trace control written by the host through viper (see trace.c). seq is
+ * odd while viper writes and is incremented by 2 at each change, so the
+ * application copies it only when seq is even and did not change during
+ * the copy. masked_procs has a bit per task and ISR2 filtered out.
+ */
+#define VP_TRACE_PROC_WORDS 8
+
+struct VP_TRACE_CTRL
+{
+    uint32_t seq;
+    uint32_t classes;
+    uint32_t sampling;
+    uint32_t masked_procs[VP_TRACE_PROC_WORDS];
+};
+
+typedef struct VP_TRACE_CTRL vp_trace_ctrl;
+
 struct VP_CTRL
 {
     int motor_csg[2];
+    vp_trace_ctrl trace;
 };
 
 typedef struct VP_CTRL vp_ctrl;
 
+/*
+ * Event to raise, answered to ADVANCE. sig is 0 when no event is pending.
+ */
+struct VP_VIRTUAL_EVENT
+{
+    int          sig;
+    int          line;      /*  interrupt line or NO_LINE       */
+    unsigned int payload;   /*  0 for NO_LINE                   */
+};
+
+typedef struct VP_VIRTUAL_EVENT vp_virtual_event;
+
 struct VP_STAT
 {
     int motor_pos[2];
+    uint64_t         date;  /*  virtual date in nanoseconds     */
+    vp_virtual_event event;
 };
 
 typedef struct VP_STAT vp_stat;
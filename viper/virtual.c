@@ -0,0 +1,307 @@
+/*
+ *  virtual.c
+ *  viper
+ *
+ *  Virtual time: the timers and the event files are sources of events
+ *  and the virtual date jumps to the next one when the application is
+ *  idle.
+ *
+ *  The next event is the one of the source with the smallest date. Two
+ *  sources of the same date are ordered by their rank, drawn from the
+ *  seed each time a source gets a new date (0 without seed), then by
+ *  their creation order. So a run only depends on the seed and on what
+ *  the application programs.
+ *
+ */
+
+#include "virtual.h"
+#include "event.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/mman.h>
+
+#define TIMER_SOURCE 0
+#define EVENT_SOURCE 1
+
+struct VP_SOURCE {
+	uint64_t date;      /*  virtual date of the next event      */
+	uint64_t rank;      /*  order among the sources of a date   */
+	uint64_t seq;       /*  creation order                      */
+	int      kind;      /*  TIMER_SOURCE or EVENT_SOURCE        */
+	/*  timer   */
+	uint64_t period;    /*  0 for a one shot timer              */
+	int      sig;
+	int      line;
+	/*  event file  */
+	vp_event_param          ev;
+	uint64_t                start;
+	const vp_event_record   *record;
+	const vp_event_record   *end;
+	void                    *map;
+	size_t                  map_size;
+};
+
+typedef struct VP_SOURCE vp_source;
+
+extern vp_stat *status;
+
+void viper_log(const char *);
+
+static int virtual_mode = 0;
+static int replaying = 0;
+static uint64_t vdate = 0;
+static uint64_t seed_state = 0;
+static uint64_t next_seq = 0;
+static vp_source **sources = NULL;
+static unsigned int source_count = 0;
+static unsigned int source_size = 0;
+static FILE *log_file = NULL;
+
+/*
+ * xorshift64*: the same seed gives the same ranks
+ */
+static uint64_t next_rank(void)
+{
+	if (seed_state == 0) {
+		return 0;
+	}
+	seed_state ^= seed_state >> 12;
+	seed_state ^= seed_state << 25;
+	seed_state ^= seed_state >> 27;
+	return seed_state * 0x2545F4914F6CDD1DULL;
+}
+
+static void add_source(vp_source *source)
+{
+	if (source_count == source_size) {
+		unsigned int size = source_size == 0 ? 8 : 2 * source_size;
+		vp_source **table = realloc(sources, size * sizeof(vp_source *));
+		if (table == NULL) {
+			viper_log("Virtual time: out of memory");
+			free(source);
+			return;
+		}
+		sources = table;
+		source_size = size;
+	}
+	source->seq = next_seq++;
+	source->rank = next_rank();
+	sources[source_count++] = source;
+}
+
+static void remove_source(unsigned int index)
+{
+	vp_source *source = sources[index];
+	if (source->kind == EVENT_SOURCE) {
+		munmap(source->map, source->map_size);
+	}
+	free(source);
+	sources[index] = sources[--source_count];
+}
+
+static int before(const vp_source *a, const vp_source *b)
+{
+	if (a->date != b->date) return a->date < b->date;
+	if (a->rank != b->rank) return a->rank < b->rank;
+	return a->seq < b->seq;
+}
+
+static void add_event_source(const vp_event_param *param)
+{
+	uint64_t count;
+	vp_source *source = malloc(sizeof(vp_source));
+	
+	if (source == NULL) {
+		return;
+	}
+	memcpy(&(source->ev), param, sizeof(vp_event_param));
+	source->ev.file_name[sizeof(source->ev.file_name) - 1] = '\0';
+	source->kind = EVENT_SOURCE;
+	source->record = vp_map_event_file(source->ev.file_name,
+	                                   &(source->map), &(source->map_size), &count);
+	if (source->record == NULL || count == 0) {
+		if (source->record != NULL) {
+			munmap(source->map, source->map_size);
+		}
+		free(source);
+		return;
+	}
+	source->end = source->record + count;
+	source->start = vdate;
+	source->date = vdate + source->record->date;
+	add_source(source);
+}
+
+static void log_event(const vp_virtual_event *event)
+{
+	vp_event_record record;
+	
+	if (log_file != NULL) {
+		record.date = vdate;
+		record.line = event->line;
+		record.payload = event->line == NO_LINE ? (uint32_t)event->sig : event->payload;
+		fwrite(&record, sizeof(record), 1, log_file);
+		/*  viper is killed when the application shuts down  */
+		fflush(log_file);
+	}
+}
+
+/*
+ * vp_virtual_init switches viper to virtual time
+ */
+void vp_virtual_init(const vp_vtime_param *param)
+{
+	char msg[600];
+	
+	virtual_mode = 1;
+	seed_state = param->seed;
+	status->date = 0;
+	
+	if (param->log_file[0] != '\0') {
+		log_file = fopen(param->log_file, "wb");
+		if (log_file == NULL) {
+			snprintf(msg, sizeof(msg), "Virtual time: cannot open the log %s", param->log_file);
+			viper_log(msg);
+		}
+		else {
+			vp_event_header header;
+			header.magic = VP_EVENT_MAGIC;
+			header.version = VP_EVENT_VERSION;
+			header.count = VP_EVENT_UNTIL_EOF;
+			fwrite(&header, sizeof(header), 1, log_file);
+		}
+	}
+	
+	if (param->replay.file_name[0] != '\0') {
+		add_event_source(&(param->replay));
+		replaying = 1;
+	}
+	
+	snprintf(msg, sizeof(msg), "Virtual time, seed %lu%s", param->seed,
+	         replaying ? ", replay" : "");
+	viper_log(msg);
+}
+
+/*
+ * vp_virtual_mode returns 1 in virtual time
+ */
+int vp_virtual_mode(void)
+{
+	return virtual_mode;
+}
+
+void vp_virtual_add_timer(const vp_timer_param *param)
+{
+	vp_source *source;
+	
+	if (replaying) {
+		return;
+	}
+	source = malloc(sizeof(vp_source));
+	if (source != NULL) {
+		source->kind = TIMER_SOURCE;
+		source->period = param->type == AUTO ? (uint64_t)param->delay * 1000 : 0;
+		source->date = vdate + (uint64_t)param->delay * 1000;
+		source->sig = param->sig;
+		source->line = param->line;
+		add_source(source);
+	}
+}
+
+void vp_virtual_add_event(const vp_event_param *param)
+{
+	if (!replaying) {
+		add_event_source(param);
+	}
+}
+
+/*
+ * vp_virtual_advance moves the virtual date to the next event and gives
+ * it to the application in the status
+ */
+void vp_virtual_advance(void)
+{
+	vp_virtual_event *event = &(status->event);
+	vp_source *source;
+	unsigned int i, next;
+	int skipped;
+	char msg[128];
+	
+	/*  the records that raise no signal are skipped    */
+	do {
+		if (source_count == 0) {
+			event->sig = 0;
+			return;
+		}
+		next = 0;
+		for (i = 1; i < source_count; i++) {
+			if (before(sources[i], sources[next])) {
+				next = i;
+			}
+		}
+		source = sources[next];
+		vdate = source->date;
+		status->date = vdate;
+		skipped = 0;
+		
+		if (source->kind == TIMER_SOURCE) {
+			event->sig = source->sig;
+			event->line = source->line;
+			event->payload = 0;
+			if (source->period != 0) {
+				source->date += source->period;
+				source->rank = next_rank();
+			}
+			else {
+				remove_source(next);
+			}
+		}
+		else {
+			const vp_event_record *record = source->record;
+			event->line = record->line;
+			event->payload = record->payload & VP_LINE_MASK;
+			if (record->line == NO_LINE) {
+				/*  the payload is the signal, not sent  */
+				event->sig = record->payload != 0 ? (int)record->payload : source->ev.sig;
+				event->payload = 0;
+				if (event->sig > SIGRTMAX) {
+					snprintf(msg, sizeof(msg),
+					         "Virtual time: event rejected, signal %u out of range",
+					         (unsigned int)record->payload);
+					viper_log(msg);
+					skipped = 1;
+				}
+			}
+			else if (record->line >= 0 &&
+			         record->line < VP_EVENT_LINE_COUNT &&
+			         source->ev.line_signal[record->line] != VP_NO_SIGNAL) {
+				event->sig = SIGRTMIN + source->ev.line_signal[record->line];
+			}
+			else {
+				/*  no signal for the line, the event is lost    */
+				if (record->line < 0 || record->line >= VP_EVENT_LINE_COUNT) {
+					snprintf(msg, sizeof(msg),
+					         "Virtual time: event rejected, line %d out of 0..%d",
+					         (int)record->line, VP_EVENT_LINE_COUNT - 1);
+				}
+				else {
+					snprintf(msg, sizeof(msg),
+					         "Virtual time: no signal for line %d", (int)record->line);
+				}
+				viper_log(msg);
+				skipped = 1;
+			}
+			source->record++;
+			if (source->record == source->end) {
+				remove_source(next);
+			}
+			else {
+				source->date = source->start + source->record->date;
+				source->rank = next_rank();
+			}
+		}
+	} while (skipped);
+	log_event(event);
+}
@@ -0,0 +1,39 @@
+/*
+ *  virtual.h
+ *  viper
+ *
+ *  Virtual time: the timers and the event files are sources of events
+ *  and the virtual date jumps to the next one when the application is
+ *  idle.
+ *
+ */
+
+#ifndef __VIRTUAL_H__
+#define __VIRTUAL_H__
+
+#include "viper.h"
+
+/*
+ * vp_virtual_init switches viper to virtual time
+ */
+void vp_virtual_init(const vp_vtime_param *param);
+
+/*
+ * vp_virtual_mode returns 1 in virtual time
+ */
+int vp_virtual_mode(void);
+
+/*
+ * vp_virtual_add_timer and vp_virtual_add_event add a source of events.
+ * They are ignored when a log is replayed.
+ */
+void vp_virtual_add_timer(const vp_timer_param *param);
+void vp_virtual_add_event(const vp_event_param *param);
+
+/*
+ * vp_virtual_advance moves the virtual date to the next event and gives
+ * it to the application in the status
+ */
+void vp_virtual_advance(void);
+
+#endif